@@ -0,0 +1,107 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#define BENCHMARK_FAMILY_ID "scan_buffer"
+
+#include <scn/scan.h>
+#include "benchmark_common.h"
+#include "bench_helpers.h"
+
+#include <deque>
+#include <list>
+
+template <typename Container>
+Container make_forward_input(std::size_t n)
+{
+    auto str = std::string{};
+    auto dist = std::uniform_int_distribution<int>{};
+    while (str.size() < n) {
+        str += std::to_string(dist(get_rng()));
+        str.push_back(' ');
+    }
+    return Container(str.begin(), str.end());
+}
+
+// Iterates over every character of a forward range through a scan_buffer.
+// ChunkSize = 1 matches the behavior of reading one character per fill().
+template <typename Container, std::size_t ChunkSize>
+static void bench_forward_buffer_iterate(benchmark::State& state)
+{
+    const auto source =
+        make_forward_input<Container>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto buf =
+            scn::detail::basic_scan_forward_buffer_impl<Container, ChunkSize>(
+                source);
+        std::size_t count = 0;
+        for (auto ch : buf.get()) {
+            count += static_cast<std::size_t>(ch == ' ');
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() *
+                                                 state.range(0)));
+}
+BENCHMARK_TEMPLATE(bench_forward_buffer_iterate, std::deque<char>, 1)
+    ->Arg(4096)
+    ->Arg(64 * 1024);
+BENCHMARK_TEMPLATE(bench_forward_buffer_iterate,
+                   std::deque<char>,
+                   scn::detail::default_forward_buffer_chunk_size)
+    ->Arg(4096)
+    ->Arg(64 * 1024);
+BENCHMARK_TEMPLATE(bench_forward_buffer_iterate, std::list<char>, 1)
+    ->Arg(4096)
+    ->Arg(64 * 1024);
+BENCHMARK_TEMPLATE(bench_forward_buffer_iterate,
+                   std::list<char>,
+                   scn::detail::default_forward_buffer_chunk_size)
+    ->Arg(4096)
+    ->Arg(64 * 1024);
+
+// Scans every integer in a forward range through a single scan_buffer.
+template <typename Container, std::size_t ChunkSize>
+static void bench_forward_buffer_scan_ints(benchmark::State& state)
+{
+    const auto source =
+        make_forward_input<Container>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto buf =
+            scn::detail::basic_scan_forward_buffer_impl<Container, ChunkSize>(
+                source);
+        auto range = buf.get();
+        while (true) {
+            auto result = scn::scan<int>(range, "{}");
+            if (!result) {
+                if (result.error() != scn::scan_error::end_of_input) {
+                    state.SkipWithError("Failed scan");
+                }
+                break;
+            }
+            benchmark::DoNotOptimize(result->value());
+            range = result->range();
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() *
+                                                 state.range(0)));
+}
+BENCHMARK_TEMPLATE(bench_forward_buffer_scan_ints, std::deque<char>, 1)
+    ->Arg(4096);
+BENCHMARK_TEMPLATE(bench_forward_buffer_scan_ints,
+                   std::deque<char>,
+                   scn::detail::default_forward_buffer_chunk_size)
+    ->Arg(4096);
@@ -0,0 +1,124 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#define BENCHMARK_FAMILY_ID "scanf_chrono"
+
+#include "benchmark_common.h"
+#include "bench_helpers.h"
+
+#include <scn/chrono.h>
+
+#include <array>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Lines of a log file, in time order:
+// `2024-09-10T23:11:10.250+02:00 [level] message`,
+// with a few milliseconds to a few seconds between consecutive lines
+static const std::vector<std::string>& get_log_lines()
+{
+    static const std::vector<std::string> lines = [] {
+        constexpr std::array<const char*, 4> levels = {"debug", "info",
+                                                       "warning", "error"};
+        constexpr std::array<const char*, 4> messages = {
+            "Connection accepted from 10.0.0.1:51234",
+            "Request GET /api/v1/items completed in 12 ms",
+            "Cache miss for key user:1234:profile",
+            "Worker 7 finished batch of 512 records"};
+
+        auto& rng = get_rng();
+        std::vector<std::string> result;
+        long long ms = 0;
+        for (int i = 0; i < 10000; ++i) {
+            ms += static_cast<long long>(rng() % 2000);
+            const auto total_sec = ms / 1000;
+            char buf[128]{};
+            std::snprintf(buf, sizeof(buf),
+                          "2024-09-10T%02lld:%02lld:%02lld.%03lld+02:00 [%s] %s",
+                          10 + total_sec / 3600, total_sec / 60 % 60,
+                          total_sec % 60, ms % 1000, levels[rng() % 4],
+                          messages[rng() % 4]);
+            result.emplace_back(buf);
+        }
+        return result;
+    }();
+    return lines;
+}
+
+using log_time_point = std::chrono::time_point<std::chrono::system_clock,
+                                               std::chrono::milliseconds>;
+
+static void bench_chrono_log_timestamp_scn(benchmark::State& state)
+{
+    const auto& lines = get_log_lines();
+    auto it = lines.begin();
+    for (auto _ : state) {
+        auto result =
+            scn::scan<log_time_point>(*it, "{:%Y-%m-%dT%H:%M:%.S%z}");
+        if (!result) {
+            state.SkipWithError("Scan error");
+            break;
+        }
+        benchmark::DoNotOptimize(result->value());
+        if (++it == lines.end()) {
+            it = lines.begin();
+        }
+    }
+}
+BENCHMARK(bench_chrono_log_timestamp_scn);
+
+static void bench_chrono_log_timestamp_scn_datetime_components(
+    benchmark::State& state)
+{
+    const auto& lines = get_log_lines();
+    auto it = lines.begin();
+    for (auto _ : state) {
+        auto result = scn::scan<scn::datetime_components>(
+            *it, "{:%Y-%m-%dT%H:%M:%.S%z}");
+        if (!result) {
+            state.SkipWithError("Scan error");
+            break;
+        }
+        benchmark::DoNotOptimize(result->value());
+        if (++it == lines.end()) {
+            it = lines.begin();
+        }
+    }
+}
+BENCHMARK(bench_chrono_log_timestamp_scn_datetime_components);
+
+static void bench_chrono_log_timestamp_scn_timestamp_scanner(
+    benchmark::State& state)
+{
+    const auto& lines = get_log_lines();
+    auto it = lines.begin();
+    auto timestamps = scn::timestamp_scanner<std::chrono::milliseconds>{
+        "%Y-%m-%dT%H:%M:%.S%z"};
+    for (auto _ : state) {
+        auto result = timestamps.scan(*it);
+        if (!result) {
+            state.SkipWithError("Scan error");
+            break;
+        }
+        benchmark::DoNotOptimize(result->value());
+        if (++it == lines.end()) {
+            it = lines.begin();
+        }
+    }
+}
+BENCHMARK(bench_chrono_log_timestamp_scn_timestamp_scanner);
@@ -81,6 +81,28 @@ BENCHMARK_TEMPLATE(scan_float_repeated_scn_value, float);
 BENCHMARK_TEMPLATE(scan_float_repeated_scn_value, double);
 BENCHMARK_TEMPLATE(scan_float_repeated_scn_value, long double);
 
+template <typename Float>
+static void scan_float_repeated_scn_floats(benchmark::State& state)
+{
+    const auto& source = get_float_string<Float>();
+    std::vector<Float> values(2 << 12);
+
+    for (auto _ : state) {
+        auto result = scn::scan_floats(source, values);
+
+        if (!result || result->value() != values.size()) {
+            state.SkipWithError("Scan error");
+            break;
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(source.size()));
+}
+BENCHMARK_TEMPLATE(scan_float_repeated_scn_floats, float);
+BENCHMARK_TEMPLATE(scan_float_repeated_scn_floats, double);
+BENCHMARK_TEMPLATE(scan_float_repeated_scn_floats, long double);
+
 template <typename Float>
 static void scan_float_repeated_sstream(benchmark::State& state)
 {
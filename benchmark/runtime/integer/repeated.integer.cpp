@@ -53,6 +53,34 @@ BENCHMARK_TEMPLATE(scan_int_repeated_scn, int);
 BENCHMARK_TEMPLATE(scan_int_repeated_scn, long long);
 BENCHMARK_TEMPLATE(scan_int_repeated_scn, unsigned);
 
+template <typename Int>
+static void scan_int_repeated_scn_compiled(benchmark::State& state)
+{
+    repeated_state<Int> s{get_integer_string<Int>()};
+
+    for (auto _ : state) {
+        auto result = scn::scan<Int>(s.view(), SCN_COMPILE("{}"));
+
+        if (!result) {
+            if (result.error() == scn::scan_error::end_of_input) {
+                s.reset();
+            }
+            else {
+                state.SkipWithError("Scan error");
+                break;
+            }
+        }
+        else {
+            s.push(result->value());
+            s.it = scn::detail::to_address(result->range().begin());
+        }
+    }
+    state.SetBytesProcessed(s.get_bytes_processed(state));
+}
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_compiled, int);
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_compiled, long long);
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_compiled, unsigned);
+
 template <typename Int>
 static void scan_int_repeated_scn_value(benchmark::State& state)
 {
@@ -141,6 +169,28 @@ BENCHMARK_TEMPLATE(scan_int_repeated_scn_int, int);
 BENCHMARK_TEMPLATE(scan_int_repeated_scn_int, long long);
 BENCHMARK_TEMPLATE(scan_int_repeated_scn_int, unsigned);
 
+template <typename Int>
+static void scan_int_repeated_scn_ints(benchmark::State& state)
+{
+    const auto& source = get_integer_string<Int>();
+    std::vector<Int> values(2 << 12);
+
+    for (auto _ : state) {
+        auto result = scn::scan_ints(source, values);
+
+        if (!result || result->value() != values.size()) {
+            state.SkipWithError("Scan error");
+            break;
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(source.size()));
+}
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_ints, int);
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_ints, long long);
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_ints, unsigned);
+
 template <typename Int>
 static void scan_int_repeated_sstream(benchmark::State& state)
 {
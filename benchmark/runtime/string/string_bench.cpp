@@ -17,6 +17,7 @@
 
 #define BENCHMARK_FAMILY_ID "scanf_string"
 
+#include <scn/prepared.h>
 #include <scn/xchar.h>
 
 #include "benchmark_common.h"
@@ -67,6 +68,37 @@ BENCHMARK(bench_string_scn<wchar_t, std::wstring, unicode_tag>);
 BENCHMARK(bench_string_scn<wchar_t, std::wstring_view, lipsum_tag>);
 BENCHMARK(bench_string_scn<wchar_t, std::wstring_view, unicode_tag>);
 
+// Input trusted to be valid UTF-8: scanned strings aren't validated
+template <typename DestStringT, typename Tag>
+static void bench_string_scn_assume_valid(benchmark::State& state)
+{
+    const auto input = get_benchmark_input<char, Tag>();
+    auto subr =
+        scn::ranges::subrange{input.data(), input.data() + input.size()};
+    for (auto _ : state) {
+        if (auto result = scn::scan<DestStringT>(
+                scn::assume_valid_utf8(subr), bench_format_string<char>())) {
+            benchmark::DoNotOptimize(result->value());
+            subr = result->range();
+        }
+        else if (result.error() == scn::scan_error::end_of_input) {
+            subr = scn::ranges::subrange{input.data(),
+                                         input.data() + input.size()};
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+
+BENCHMARK(bench_string_scn_assume_valid<std::string_view, lipsum_tag>);
+BENCHMARK(bench_string_scn_assume_valid<std::string_view, unicode_tag>);
+BENCHMARK(bench_string_scn_assume_valid<std::string, lipsum_tag>);
+BENCHMARK(bench_string_scn_assume_valid<std::string, unicode_tag>);
+BENCHMARK(bench_string_scn_assume_valid<std::wstring, lipsum_tag>);
+BENCHMARK(bench_string_scn_assume_valid<std::wstring, unicode_tag>);
+
 template <typename SourceCharT, typename DestStringT, typename Tag>
 static void bench_string_scn_value(benchmark::State& state)
 {
@@ -100,6 +132,63 @@ BENCHMARK(bench_string_scn_value<wchar_t, std::wstring, unicode_tag>);
 BENCHMARK(bench_string_scn_value<wchar_t, std::wstring_view, lipsum_tag>);
 BENCHMARK(bench_string_scn_value<wchar_t, std::wstring_view, unicode_tag>);
 
+// Words separated by ASCII spaces or no-break spaces:
+// the no-break space makes the character set non-ASCII.
+// Reading a character set doesn't check for EOF,
+// so the end of the input is detected by checking for an empty range.
+constexpr std::string_view bench_charset_format_string =
+    "{:[^ \t\n\r\u00A0]} ";
+
+template <typename Tag>
+static void bench_string_scn_charset(benchmark::State& state)
+{
+    auto input = get_benchmark_input<char, Tag>();
+    auto subr = scn::ranges::subrange{input};
+    for (auto _ : state) {
+        if (auto result = scn::scan<std::string_view>(
+                subr, scn::runtime_format(bench_charset_format_string))) {
+            benchmark::DoNotOptimize(result->value());
+            subr = result->range();
+        }
+        else if (result.error() == scn::scan_error::end_of_input ||
+                 subr.begin() == subr.end()) {
+            subr = scn::ranges::subrange{input};
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_string_scn_charset<lipsum_tag>);
+BENCHMARK(bench_string_scn_charset<unicode_tag>);
+
+template <typename Tag>
+static void bench_string_scn_charset_prepared(benchmark::State& state)
+{
+    auto input = get_benchmark_input<char, Tag>();
+    auto subr = scn::ranges::subrange{input};
+    const auto format =
+        scn::prepare_format<std::string_view>(bench_charset_format_string)
+            .value();
+    for (auto _ : state) {
+        if (auto result = scn::scan(subr, format)) {
+            benchmark::DoNotOptimize(result->value());
+            subr = result->range();
+        }
+        else if (result.error() == scn::scan_error::end_of_input ||
+                 subr.begin() == subr.end()) {
+            subr = scn::ranges::subrange{input};
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_string_scn_charset_prepared<lipsum_tag>);
+BENCHMARK(bench_string_scn_charset_prepared<unicode_tag>);
+
 template <typename CharT, typename Tag>
 static void bench_string_sstream(benchmark::State& state)
 {
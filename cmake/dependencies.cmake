@@ -7,6 +7,11 @@ if (CMAKE_FIND_PACKAGE_SORT_ORDER)
 endif ()
 set(CMAKE_FIND_PACKAGE_SORT_ORDER NATURAL)
 
+# Threads, for <scn/parallel.h>
+if (NOT TARGET Threads::Threads)
+    find_package(Threads REQUIRED)
+endif ()
+
 if (SCN_TESTS)
     # GTest
 
@@ -345,39 +345,112 @@ enum class numeric_system {
     alternative_o,  // 'O'
 };
 
+/**
+ * Number of days from 1970-01-01 to `y`-`m`-`d`, in the proleptic Gregorian
+ * calendar, without going through `std::tm` or the C library.
+ *
+ * Days out of range for the month are counted from its first day,
+ * like they would be with `std::mktime`.
+ *
+ * See http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+ */
+constexpr std::int64_t days_from_civil(std::int64_t y, unsigned m, int d)
+{
+    y -= m <= 2;
+    const std::int64_t era = (y >= 0 ? y : y - 399) / 400;
+    // Year of era, [0, 399]
+    const auto yoe = static_cast<unsigned>(y - era * 400);
+    // Day of year, counted from March 1st, [0, 365]
+    const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5;
+    // Day of era, [0, 146096]
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<std::int64_t>(doe) - 719468 + (d - 1);
+}
+
+/**
+ * Converts `time` (whole seconds since the Unix epoch)
+ * and `subsec` (fractions of a second) into `Duration`.
+ *
+ * \return `std::nullopt`, if the result doesn't fit in `Duration`.
+ */
 template <typename Duration>
-std::optional<Duration> time_since_unix_epoch(const datetime_components& dt)
+std::optional<Duration> time_since_unix_epoch(std::chrono::seconds time,
+                                              std::optional<double> subsec)
 {
     static_assert(std::is_integral_v<typename Duration::rep>);
     static_assert(Duration::period::type::den <= std::nano::den);
 
-    if (dt.tz_offset || dt.tz_name || dt.wday || dt.yday) {
-        return std::nullopt;
+    if constexpr (std::ratio_less_equal_v<typename Duration::period,
+                                          std::ratio<1>>) {
+        constexpr auto max_time =
+            std::chrono::duration_cast<std::chrono::seconds>(Duration::max());
+        constexpr auto min_time =
+            std::chrono::duration_cast<std::chrono::seconds>(Duration::min());
+        if (time >= max_time || time <= min_time) {
+            return std::nullopt;
+        }
     }
 
-    auto tm = dt.to_tm();
-    // TODO: overflow checks
-#if SCN_MSVC && defined(SCN_MODULE)
-    // Workaround for https://github.com/llvm/llvm-project/issues/64812
-    // (can't use <ctime> std:: functions in modules)
-    auto time = std::chrono::seconds{::mktime(&tm)};
-#else
-    auto time = std::chrono::seconds{std::mktime(&tm)};
-#endif
     if constexpr (Duration::period::type::den > std::intmax_t{1}) {
         // Duration more precise than seconds (seconds is std::ratio<1, 1>)
-        if (dt.subsec) {
+        if (subsec) {
             auto subsec_in_ns =
                 std::chrono::nanoseconds{static_cast<std::int64_t>(
-                    *dt.subsec * static_cast<double>(std::nano::den))};
-            return std::chrono::duration_cast<Duration>(time + subsec_in_ns);
+                    *subsec * static_cast<double>(std::nano::den))};
+            return std::chrono::duration_cast<Duration>(time) +
+                   std::chrono::duration_cast<Duration>(subsec_in_ns);
         }
     }
+    else {
+        SCN_UNUSED(subsec);
+    }
     // Duration is seconds or larger, or subsec is not set
     // -> ignore subsec
     return std::chrono::duration_cast<Duration>(time);
 }
 
+/**
+ * Converts the fields of `dt` into a duration since the Unix epoch,
+ * interpreting them as UTC, adjusted by `tz_offset`, if set.
+ * Unset fields default to the same values as with `to_tm()`.
+ *
+ * Doesn't use `std::mktime`: it's not affected by the `TZ` environment
+ * variable, and doesn't take the timezone lock of the C library.
+ *
+ * \return `std::nullopt`, if the time point can't be determined
+ * (`tz_name`, `wday`, or `yday` is set),
+ * or if it doesn't fit in `Duration`.
+ */
+template <typename Duration>
+std::optional<Duration> time_since_unix_epoch(const datetime_components& dt)
+{
+    if (dt.tz_name || dt.wday || dt.yday) {
+        return std::nullopt;
+    }
+
+    const auto days = days_from_civil(
+        dt.year.value_or(1900), static_cast<unsigned>(dt.mon.value_or(January)),
+        static_cast<int>(dt.mday.value_or(0)));
+    auto time = std::chrono::seconds{
+        days * 86400 + std::int64_t{dt.hour.value_or(0)} * 3600 +
+        std::int64_t{dt.min.value_or(0)} * 60 + std::int64_t{dt.sec.value_or(0)}};
+    if (dt.tz_offset) {
+        time -= *dt.tz_offset;
+    }
+    return time_since_unix_epoch<Duration>(time, dt.subsec);
+}
+
+/// Layout of an ISO 8601 timestamp chrono format string:
+/// `%Y-%m-%dT%H:%M:%S`, or an equivalent
+struct iso8601_layout {
+    /// Separator between the date and the time: `T` or a space
+    char separator{'T'};
+    /// `%.S` instead of `%S`
+    bool subsec{false};
+    /// Followed by `%z`
+    bool tz_offset{false};
+};
+
 template <typename CharT, typename Handler>
 constexpr const CharT* parse_chrono_format_specs(const CharT* begin,
                                                  const CharT* end,
@@ -1730,6 +1803,8 @@ struct scanner<year_month_day, CharT>
     }
 };
 
+// `std::chrono::sys_time<Duration>`:
+// the scanned date and time are in UTC, offset by `%z`, if given
 template <typename CharT, typename Duration>
 struct scanner<std::chrono::time_point<std::chrono::system_clock, Duration>,
                CharT> : public detail::chrono_component_scanner<CharT> {
@@ -1756,6 +1831,109 @@ struct scanner<std::chrono::time_point<std::chrono::system_clock, Duration>,
     }
 };
 
+namespace detail {
+/// State of `scn::timestamp_scanner`
+struct timestamp_prefix_cache {
+    /// `YYYY-MM-DDTHH:MM` of the last timestamp read
+    char prefix[16]{};
+    /// `prefix`, as seconds since the Unix epoch
+    std::chrono::seconds prefix_time{};
+    bool has_prefix{false};
+};
+
+struct prefix_cached_timestamp {
+    std::chrono::seconds time{};
+    std::optional<double> subsec{};
+    const char* end{nullptr};
+};
+
+std::optional<iso8601_layout> detect_iso8601_timestamp_format(
+    std::string_view format);
+
+/// Read a timestamp with the layout `layout` from the beginning of `source`,
+/// parsing only the seconds and what follows them,
+/// if the date, hour, and minute are the same as in the previous timestamp.
+/// Returns `false`, if `source` doesn't have the exact layout, or if any of
+/// the values are out of range: the generic reader is used then.
+bool read_timestamp_with_prefix_cache(const iso8601_layout& layout,
+                                      timestamp_prefix_cache& cache,
+                                      std::string_view source,
+                                      prefix_cached_timestamp& ts);
+}  // namespace detail
+
+/**
+ * Scans a `std::chrono::sys_time<Duration>` from each of a sequence of
+ * inputs, like `scn::scan<sys_time<Duration>>(source, "{:" + format + "}")`
+ * would.
+ *
+ * Meant for timestamps in time order, e.g. at the start of every line of a
+ * log file, in the ISO 8601 layout `%Y-%m-%dT%H:%M:%S` (or `%FT%T`, with a
+ * space instead of `T`, `%.S` instead of `%S`, and an optional trailing
+ * `%z`). The date, hour, and minute of the previous timestamp are
+ * remembered, together with the corresponding time point. When they're
+ * the same, byte for byte, in the next input, only the seconds, and what
+ * follows them, are parsed.
+ *
+ * Other chrono format strings, and inputs not in the exact fixed-width
+ * layout, are scanned as usual, without the cache.
+ *
+ * Stateful: not to be used from multiple threads at once.
+ *
+ * \code{.cpp}
+ * auto timestamps =
+ *     scn::timestamp_scanner<std::chrono::milliseconds>{"%FT%H:%M:%.S%z"};
+ * for (auto& line : lines) {
+ *     auto result = timestamps.scan(line);
+ *     // ...
+ * }
+ * \endcode
+ */
+template <typename Duration>
+class timestamp_scanner {
+public:
+    using time_point_type =
+        std::chrono::time_point<std::chrono::system_clock, Duration>;
+    using result_type = scan_result_type<std::string_view, time_point_type>;
+
+    /// `format` is a chrono format string, without the surrounding `{:` `}`
+    explicit timestamp_scanner(std::string_view format)
+        : m_format("{:"),
+          m_layout(detail::detect_iso8601_timestamp_format(format))
+    {
+        m_format.append(format);
+        m_format.push_back('}');
+    }
+
+    SCN_NODISCARD result_type scan(std::string_view source)
+    {
+        if (m_layout) {
+            detail::prefix_cached_timestamp ts{};
+            if (detail::read_timestamp_with_prefix_cache(*m_layout, m_cache,
+                                                         source, ts)) {
+                auto result = result_type();
+                if (auto t = detail::time_since_unix_epoch<Duration>(
+                        ts.time, ts.subsec)) {
+                    result->value() = time_point_type{*t};
+                    result->set_range(ranges::subrange{
+                        source.begin() + (ts.end - source.data()),
+                        source.end()});
+                }
+                else {
+                    result = unexpected(scan_error{
+                        scan_error::invalid_scanned_value, "Invalid unix epoch"});
+                }
+                return result;
+            }
+        }
+        return scn::scan<time_point_type>(source, runtime_format(m_format));
+    }
+
+private:
+    std::string m_format;
+    std::optional<detail::iso8601_layout> m_layout;
+    detail::timestamp_prefix_cache m_cache{};
+};
+
 SCN_END_NAMESPACE
 }  // namespace scn
 
@@ -242,6 +242,8 @@ template <typename CharT>
 class basic_regex_match;
 template <typename CharT>
 class basic_regex_matches;
+template <typename CharT, std::size_t N>
+class basic_static_regex_matches;
 
 using regex_match = basic_regex_match<char>;
 using wregex_match = basic_regex_match<wchar_t>;
@@ -249,6 +251,11 @@ using wregex_match = basic_regex_match<wchar_t>;
 using regex_matches = basic_regex_matches<char>;
 using wregex_matches = basic_regex_matches<wchar_t>;
 
+template <std::size_t N>
+using static_regex_matches = basic_static_regex_matches<char, N>;
+template <std::size_t N>
+using wstatic_regex_matches = basic_static_regex_matches<wchar_t, N>;
+
 #if SCN_HAS_INT128
 
 SCN_GCC_PUSH
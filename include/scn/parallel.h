@@ -0,0 +1,273 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#pragma once
+
+#include <scn/prepared.h>
+#include <scn/scan.h>
+
+#if defined(SCN_MODULE) && defined(SCN_IMPORT_STD)
+import std;
+#else
+#include <memory>
+#include <utility>
+#include <vector>
+#endif
+
+namespace scn {
+SCN_BEGIN_NAMESPACE
+
+/**
+ * \defgroup parallel Parallel scanning
+ *
+ * In header `<scn/parallel.h>`
+ *
+ * Scanning of large contiguous inputs, made up of records separated by a
+ * delimiter (e.g. the lines of a memory-mapped file), on multiple threads.
+ */
+
+class scan_executor;
+
+namespace detail {
+struct parallel_scan_chunk_jobs;
+
+/// Run `jobs` on the worker threads of `executor`.
+/// Returns after every chunk has been delivered.
+void run_parallel_scan(const parallel_scan_chunk_jobs& jobs,
+                       scan_executor& executor);
+}  // namespace detail
+
+/**
+ * A pool of threads for `scn::parallel_scan_lines`.
+ *
+ * Every worker thread has a queue of chunks of the input to scan.
+ * When its own queue runs out, a worker steals half of the remaining
+ * chunks of another one, so that the work stays balanced even when the
+ * records, and thus the time taken to scan a chunk, vary a lot in size.
+ *
+ * Reusing an executor avoids starting new threads on every call to
+ * `parallel_scan_lines`. Runs one `parallel_scan_lines` at a time:
+ * concurrent calls with the same executor wait for each other.
+ * Must not be used from within the callback given to `parallel_scan_lines`.
+ *
+ * \ingroup parallel
+ */
+class scan_executor {
+public:
+    /// Starts `thread_count` worker threads.
+    /// If `0`, `std::thread::hardware_concurrency()` is used.
+    explicit scan_executor(std::size_t thread_count = 0);
+
+    scan_executor(const scan_executor&) = delete;
+    scan_executor(scan_executor&&) = delete;
+    scan_executor& operator=(const scan_executor&) = delete;
+    scan_executor& operator=(scan_executor&&) = delete;
+
+    /// Stops and joins the worker threads
+    ~scan_executor();
+
+    SCN_NODISCARD std::size_t thread_count() const;
+
+private:
+    friend void detail::run_parallel_scan(
+        const detail::parallel_scan_chunk_jobs& jobs,
+        scan_executor& executor);
+
+    struct impl;
+    std::unique_ptr<impl> m_impl;
+};
+
+/**
+ * Options for `scn::parallel_scan_lines`.
+ *
+ * \ingroup parallel
+ */
+struct parallel_scan_options {
+    /// Number of threads to scan with.
+    /// If `0`, `std::thread::hardware_concurrency()` is used.
+    std::size_t thread_count{0};
+    /// Delimiter between records
+    char delimiter{'\n'};
+    /// Executor to scan with.
+    /// If `nullptr`, one with `thread_count` threads is created for the call.
+    scan_executor* executor{nullptr};
+};
+
+namespace detail {
+/// A part of the input, made up of whole records
+/// (a range of records in `split_at_delimiters`)
+struct parallel_scan_chunk_jobs {
+    std::size_t chunk_count;
+    void* context;
+    /// Scan the records of a chunk, called on a worker thread
+    void (*scan_chunk)(void* context, std::size_t chunk);
+    /// Deliver the results of a chunk,
+    /// called on the calling thread, in order
+    void (*deliver_chunk)(void* context, std::size_t chunk);
+};
+
+/// Number of threads to use, based on `parallel_scan_options::thread_count`
+std::size_t parallel_scan_thread_count(std::size_t requested);
+
+/// Number of chunks to split an input of `size` bytes into,
+/// for `thread_count` threads
+std::size_t parallel_scan_chunk_count(std::size_t size,
+                                      std::size_t thread_count);
+
+/// Split `buffer` into `chunk_count` chunks of roughly equal size,
+/// each ending right after a `delimiter`, or at the end of `buffer`.
+/// Some of the chunks may be empty.
+void split_at_delimiters(std::string_view buffer,
+                         char delimiter,
+                         std::string_view* chunks,
+                         std::size_t chunk_count);
+
+/// Run `jobs` on `thread_count` worker threads.
+/// Returns after every chunk has been delivered.
+void run_parallel_scan(const parallel_scan_chunk_jobs& jobs,
+                       std::size_t thread_count);
+}  // namespace detail
+
+/**
+ * Scans every record (line) in `buffer` with `format`, on multiple threads.
+ *
+ * `buffer` is split into chunks at `options.delimiter`, which are scanned
+ * concurrently. The records don't include the delimiter. An empty record
+ * after the last delimiter is skipped.
+ *
+ * `callback` is called with every record, and the result of scanning it
+ * (of type `scan_result_type<std::string_view, Args...>`), as
+ * `callback(std::string_view record, result&)`. The calls are made from the
+ * calling thread, in the order of the records in `buffer`: `callback`
+ * doesn't need to be thread-safe.
+ *
+ * The format string has been parsed in advance, and isn't parsed again
+ * for every record.
+ *
+ * \code{.cpp}
+ * auto format = scn::prepare_format<std::string, int>("{} {}").value();
+ * scn::parallel_scan_lines(file_contents, format,
+ *     [&](std::string_view line, auto& result) {
+ *         if (!result) {
+ *             // error in `line`
+ *         }
+ *         auto& [name, value] = result->values();
+ *         // ...
+ *     });
+ * \endcode
+ *
+ * \ingroup parallel
+ */
+template <typename... Args, typename Callback>
+void parallel_scan_lines(std::string_view buffer,
+                         const prepared_format<Args...>& format,
+                         Callback&& callback,
+                         parallel_scan_options options = {})
+{
+    using result_type = scan_result_type<std::string_view, Args...>;
+    struct chunk_type {
+        std::string_view source;
+        std::vector<std::pair<std::string_view, result_type>> results;
+    };
+    struct context_type {
+        const prepared_format<Args...>& format;
+        Callback& callback;
+        char delimiter;
+        std::vector<chunk_type> chunks;
+    };
+
+    const auto thread_count =
+        options.executor
+            ? options.executor->thread_count()
+            : detail::parallel_scan_thread_count(options.thread_count);
+    const auto chunk_count =
+        detail::parallel_scan_chunk_count(buffer.size(), thread_count);
+    context_type context{format, callback, options.delimiter,
+                         std::vector<chunk_type>(chunk_count)};
+    {
+        std::vector<std::string_view> sources(chunk_count);
+        detail::split_at_delimiters(buffer, options.delimiter, sources.data(),
+                                    chunk_count);
+        for (std::size_t i = 0; i < chunk_count; ++i) {
+            context.chunks[i].source = sources[i];
+        }
+    }
+
+    auto scan_chunk = [](void* ctx, std::size_t i) {
+        auto& c = *static_cast<context_type*>(ctx);
+        auto& chunk = c.chunks[i];
+        auto rest = chunk.source;
+        while (!rest.empty()) {
+            const auto record_end = rest.find(c.delimiter);
+            const auto record = rest.substr(0, record_end);
+            chunk.results.emplace_back(record, scn::scan(record, c.format));
+            if (record_end == std::string_view::npos) {
+                break;
+            }
+            rest.remove_prefix(record_end + 1);
+        }
+    };
+    auto deliver_chunk = [](void* ctx, std::size_t i) {
+        auto& c = *static_cast<context_type*>(ctx);
+        auto& chunk = c.chunks[i];
+        for (auto& [record, result] : chunk.results) {
+            c.callback(record, result);
+        }
+        // Release memory as we go
+        chunk.results = decltype(chunk.results){};
+    };
+
+    const detail::parallel_scan_chunk_jobs jobs{chunk_count, &context,
+                                                scan_chunk, deliver_chunk};
+    if (options.executor && chunk_count > 1) {
+        detail::run_parallel_scan(jobs, *options.executor);
+    }
+    else {
+        detail::run_parallel_scan(jobs, thread_count);
+    }
+}
+
+/**
+ * `parallel_scan_lines` with a format string,
+ * which is parsed once, with `scn::prepare_format`.
+ *
+ * \return `scan_error::invalid_format_string`, if `format` is invalid
+ * (a format string checked at compile time can't be).
+ *
+ * \code{.cpp}
+ * auto result = scn::parallel_scan_lines<std::string, int>(
+ *     file_contents, "{} {}", [&](std::string_view line, auto& result) {
+ *         // ...
+ *     });
+ * \endcode
+ *
+ * \ingroup parallel
+ */
+template <typename... Args, typename Callback>
+scan_expected<void> parallel_scan_lines(
+    std::string_view buffer,
+    scan_format_string<std::string_view, Args...> format,
+    Callback&& callback,
+    parallel_scan_options options = {})
+{
+    SCN_TRY(prepared, prepare_format<Args...>(format.get()));
+    parallel_scan_lines(buffer, prepared, callback, options);
+    return {};
+}
+
+SCN_END_NAMESPACE
+}  // namespace scn
@@ -0,0 +1,271 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#pragma once
+
+#include <scn/scan.h>
+
+#if defined(SCN_MODULE) && defined(SCN_IMPORT_STD)
+import std;
+#else
+#include <algorithm>
+#include <vector>
+#endif
+
+namespace scn {
+SCN_BEGIN_NAMESPACE
+
+namespace detail {
+/**
+ * `compiled_format_builder`, for format strings only known at runtime.
+ *
+ * Does the checks `format_string_checker` would do at compile time,
+ * and reports errors through `get_error()`, instead of failing to compile.
+ */
+template <typename... Args>
+class prepared_format_builder
+    : public compiled_format_builder<char, std::string_view, Args...> {
+    using base = compiled_format_builder<char, std::string_view, Args...>;
+
+public:
+    using op_type = typename base::op_type;
+
+    prepared_format_builder(std::string_view format_str, op_type* ops)
+        : base(format_str, ops)
+    {
+    }
+
+    void on_replacement_field(std::size_t id, const char* begin)
+    {
+        if (set_arg_as_read(id)) {
+            base::on_replacement_field(id, begin);
+        }
+    }
+
+    const char* on_format_specs(std::size_t id,
+                                const char* begin,
+                                const char* end)
+    {
+        if (!set_arg_as_read(id)) {
+            return begin;
+        }
+        return base::on_format_specs(id, begin, end);
+    }
+
+    void check_args_exhausted()
+    {
+        for (std::size_t i = 0; i < base::num_args; ++i) {
+            if (!m_visited_args[i]) {
+                return this->on_error("Argument list not exhausted");
+            }
+        }
+    }
+
+    scan_expected<void> get_error()
+    {
+        return this->m_parse_context.get_error();
+    }
+
+private:
+    bool set_arg_as_read(std::size_t id)
+    {
+        if (id >= base::num_args) {
+            this->on_error("Invalid out-of-range argument ID");
+            return false;
+        }
+        if (m_visited_args[id]) {
+            this->on_error("Argument with this ID already scanned");
+            return false;
+        }
+        m_visited_args[id] = true;
+        return true;
+    }
+
+    bool m_visited_args[base::num_args > 0 ? base::num_args : 1]{};
+};
+
+/// Parse the non-ASCII code points of the character set `charset`
+/// (`[...]`) into sorted, disjoint ranges, as is done when reading with it.
+scan_expected<void> parse_charset_nonascii_ranges(
+    std::string_view charset,
+    std::vector<std::pair<char32_t, char32_t>>& ranges);
+}  // namespace detail
+
+/**
+ * \defgroup prepared Prepared format strings
+ *
+ * In header `<scn/prepared.h>`
+ *
+ * A format string only known at runtime, e.g. read from a configuration
+ * file, is normally parsed again on every call to `scan` with
+ * `scn::runtime_format`. If it's used to scan a lot of input,
+ * it can instead be parsed once with `scn::prepare_format`, and the
+ * resulting `scn::prepared_format` can be given to `scan` in its place.
+ *
+ * \code{.cpp}
+ * auto format = scn::prepare_format<int, std::string>(config.format);
+ * if (!format) {
+ *     // invalid format string: format.error()
+ * }
+ * for (auto& line : lines) {
+ *     auto result = scn::scan(line, *format);
+ *     // ...
+ * }
+ * \endcode
+ */
+
+template <typename... Args>
+class prepared_format;
+
+template <typename... Args>
+auto prepare_format(std::string_view format)
+    -> scan_expected<prepared_format<Args...>>;
+
+/**
+ * A format string, parsed at runtime into a sequence of literal text and
+ * replacement fields, with the format specifiers of every built-in type,
+ * including the ranges of the non-ASCII characters in `{:[...]}`,
+ * already parsed, and the lookup matching them already built.
+ *
+ * Created with `scn::prepare_format`.
+ * Owns a copy of the format string. Move-only.
+ * Not modified by scanning, so it can be shared between threads.
+ *
+ * Checks that depend on the source range scanned from
+ * (e.g. reading a `string_view` from a non-contiguous source)
+ * are done when scanning.
+ *
+ * \ingroup prepared
+ */
+template <typename... Args>
+class prepared_format {
+public:
+    using op_type = detail::compiled_format_op<char>;
+
+    prepared_format(const prepared_format&) = delete;
+    prepared_format& operator=(const prepared_format&) = delete;
+    prepared_format(prepared_format&&) noexcept = default;
+    prepared_format& operator=(prepared_format&&) noexcept = default;
+    ~prepared_format() = default;
+
+    /// The format string
+    SCN_NODISCARD std::string_view get() const
+    {
+        return {m_str.data(), m_str.size()};
+    }
+
+    SCN_NODISCARD detail::compiled_format_view<char> view() const
+    {
+        return {get(), m_ops.data(), m_ops.size()};
+    }
+
+private:
+    friend auto prepare_format<Args...>(std::string_view format)
+        -> scan_expected<prepared_format<Args...>>;
+
+    prepared_format() = default;
+
+    // Pointers to all of these are stored in `m_ops`:
+    // a `std::vector` keeps its buffer when moved from
+    std::vector<char> m_str;
+    std::vector<op_type> m_ops;
+    std::vector<std::vector<std::pair<char32_t, char32_t>>> m_charset_ranges;
+    // Reserved up front, so that the elements never move
+    std::vector<detail::charset_nonascii_lookup> m_charset_lookups;
+};
+
+/**
+ * Parse `format` into a `prepared_format`, to scan `Args...` with.
+ *
+ * \return The prepared format string, or
+ * `scan_error::invalid_format_string`, if `format` is invalid for `Args...`.
+ *
+ * \ingroup prepared
+ */
+template <typename... Args>
+auto prepare_format(std::string_view format)
+    -> scan_expected<prepared_format<Args...>>
+{
+    prepared_format<Args...> result;
+    result.m_str.assign(format.begin(), format.end());
+    const auto str = result.get();
+
+    {
+        auto builder = detail::prepared_format_builder<Args...>{str, nullptr};
+        SCN_TRY_DISCARD(detail::parse_format_string<false>(str, builder));
+        result.m_ops.resize(builder.size());
+    }
+    {
+        auto builder = detail::prepared_format_builder<Args...>{
+            str, result.m_ops.data()};
+        SCN_TRY_DISCARD(detail::parse_format_string<false>(str, builder));
+    }
+
+    using op_type = detail::compiled_format_op<char>;
+    const auto has_nonascii_charset = [](const op_type& op) {
+        return op.kind == op_type::kind_type::specs_field &&
+               op.specs.type == detail::presentation_type::string_set &&
+               op.specs.charset_has_nonascii;
+    };
+    result.m_charset_lookups.reserve(static_cast<std::size_t>(
+        std::count_if(result.m_ops.begin(), result.m_ops.end(),
+                      has_nonascii_charset)));
+    for (op_type& op : result.m_ops) {
+        if (!has_nonascii_charset(op)) {
+            continue;
+        }
+
+        auto& ranges = result.m_charset_ranges.emplace_back();
+        SCN_TRY_DISCARD(detail::parse_charset_nonascii_ranges(
+            op.specs.charset_string<char>(), ranges));
+        op.specs.charset_nonascii_ranges = ranges.data();
+        op.specs.charset_nonascii_ranges_size = ranges.size();
+        op.specs.charset_lookup =
+            &result.m_charset_lookups.emplace_back(ranges.data(),
+                                                   ranges.size());
+    }
+
+    return result;
+}
+
+/**
+ * `scan` with a prepared format string.
+ *
+ * `Args...` can be deduced from `format`.
+ *
+ * \code{.cpp}
+ * auto format = scn::prepare_format<int, int>("{} {}").value();
+ * auto result = scn::scan(source, format);
+ * \endcode
+ *
+ * \ingroup prepared
+ */
+template <typename... Args,
+          typename Source,
+          typename = std::enable_if_t<detail::is_file_or_narrow_range<Source>>>
+SCN_NODISCARD auto scan(Source&& source, const prepared_format<Args...>& format)
+    -> scan_result_type<Source, Args...>
+{
+    auto result = make_scan_result<Source, Args...>();
+    fill_scan_result(result, detail::vscan_compiled_generic(
+                                 SCN_FWD(source), format.view(),
+                                 scan_args{make_scan_args(result->values())}));
+    return result;
+}
+
+SCN_END_NAMESPACE
+}  // namespace scn
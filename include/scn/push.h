@@ -0,0 +1,153 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#pragma once
+
+#include <scn/scan.h>
+
+#if defined(SCN_MODULE) && defined(SCN_IMPORT_STD)
+import std;
+#else
+#include <optional>
+#include <tuple>
+#endif
+
+namespace scn {
+SCN_BEGIN_NAMESPACE
+
+/**
+ * \defgroup push Incremental scanning
+ *
+ * In header `<scn/push.h>`
+ *
+ * Scanning of input that arrives in fragments, e.g. from a non-blocking
+ * socket, without blocking to wait for the rest of it.
+ */
+
+/**
+ * Scans a stream of input, that's fed to it in fragments with `feed()`.
+ *
+ * A scan, that runs out of fed input, doesn't fail with
+ * `scan_error::end_of_input`, but reports that more input is needed,
+ * by returning `std::nullopt`. The same scan can then be tried again,
+ * after more input has been fed, until `finish()` is called to mark the
+ * end of the stream.
+ *
+ * A scan, that needs more input, is started over from the beginning,
+ * when it's tried again: scanning a value isn't suspended in the middle.
+ * Thus, the values of a scan should be kept small enough to fit in a
+ * few fragments, e.g. by scanning a single message at a time.
+ * Note, that a scan ending in a value without a terminator, or in
+ * whitespace in the format string, always runs into the end of the fed
+ * input, and can't complete before more of it is fed, or `finish()` is
+ * called.
+ *
+ * The fragments aren't copied: a fragment given to `feed()` needs to stay
+ * valid until the next call to `feed()`. At that point, the characters of
+ * it not yet consumed by a successful scan are copied into an internal
+ * buffer. When a fragment ends at a message boundary, nothing is copied.
+ *
+ * \code{.cpp}
+ * scn::push_scanner scanner;
+ * while (auto fragment = receive()) {
+ *     scanner.feed(*fragment);
+ *     while (auto result = scanner.scan<std::string, int>("{} {};")) {
+ *         if (!*result) {
+ *             // error: result->error()
+ *             break;
+ *         }
+ *         auto& [name, value] = **result;
+ *         // ...
+ *     }
+ *     // scanning needs more input
+ * }
+ * scanner.finish();
+ * \endcode
+ *
+ * \ingroup push
+ */
+class push_scanner {
+public:
+    using range_type = detail::scan_buffer::range_type;
+
+    push_scanner() = default;
+
+    /**
+     * Feed the next fragment of input.
+     * `data` needs to stay valid until the next call to `feed()`,
+     * or the destruction of `*this`.
+     *
+     * \pre `finish()` hasn't been called.
+     */
+    void feed(std::string_view data)
+    {
+        m_buffer.feed(data);
+    }
+
+    /// Mark the end of input: running out of it is EOF from now on.
+    void finish()
+    {
+        m_buffer.finish();
+    }
+
+    SCN_NODISCARD bool is_finished() const
+    {
+        return m_buffer.is_finished();
+    }
+
+    /// Number of characters consumed by successful scans
+    SCN_NODISCARD std::ptrdiff_t position() const
+    {
+        return m_position;
+    }
+
+    /**
+     * Scan `Args...` from the input fed so far, that hasn't been consumed
+     * by previous successful scans, according to `format`.
+     *
+     * \return `std::nullopt`, if the input ran out before the scan was
+     * complete, and `finish()` hasn't been called. Nothing is consumed:
+     * the scan should be tried again after calling `feed()`.
+     * Otherwise, the scanned values, or an error.
+     * On error, nothing is consumed.
+     */
+    template <typename... Args>
+    SCN_NODISCARD auto scan(scan_format_string<range_type, Args...> format)
+        -> std::optional<scan_expected<std::tuple<Args...>>>
+    {
+        m_buffer.clear_reached_end();
+        auto values = std::tuple<Args...>{};
+        auto n = detail::vscan_impl(m_buffer, format.get(),
+                                    make_scan_args(values));
+        if (m_buffer.needs_more_input()) {
+            return std::nullopt;
+        }
+        if (SCN_UNLIKELY(!n)) {
+            return scan_expected<std::tuple<Args...>>{unexpected(n.error())};
+        }
+
+        m_position += *n;
+        return scan_expected<std::tuple<Args...>>{SCN_MOVE(values)};
+    }
+
+private:
+    detail::scan_push_buffer m_buffer;
+    std::ptrdiff_t m_position{0};
+};
+
+SCN_END_NAMESPACE
+}  // namespace scn
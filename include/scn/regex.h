@@ -233,6 +233,7 @@ class basic_regex_matches
     using base = std::vector<std::optional<basic_regex_match<CharT>>>;
 
 public:
+    using char_type = CharT;
     using match_type = basic_regex_match<CharT>;
     using typename base::const_iterator;
     using typename base::const_reverse_iterator;
@@ -304,6 +305,160 @@ struct scanner<basic_regex_matches<CharT>, CharT>
     }
 };
 
+namespace detail {
+/// Caller-provided storage for the matches of a regex,
+/// used to scan a `basic_static_regex_matches`
+template <typename CharT>
+struct regex_matches_storage {
+    using char_type = CharT;
+
+    std::optional<basic_regex_match<CharT>>* data;
+    std::size_t capacity;
+    std::size_t size{0};
+};
+
+template <typename CharT>
+inline constexpr bool is_type_disabled<regex_matches_storage<CharT>> = false;
+
+template <typename Context>
+scan_expected<typename Context::iterator> scan_regex_matches_into_storage(
+    regex_matches_storage<typename Context::char_type>& storage,
+    Context& ctx,
+    const format_specs& specs);
+}  // namespace detail
+
+/**
+ * Like `basic_regex_matches`, but with a fixed capacity of `N` matches,
+ * stored inline. Scanning one doesn't allocate memory for the matches,
+ * which refer to the source range.
+ *
+ * The names of named captures are not stored:
+ * `basic_regex_match::name()` is always empty.
+ * If the regex has more than `N - 1` subexpressions,
+ * scanning fails with `scan_error::invalid_format_string`.
+ *
+ * \code{.cpp}
+ * auto result = scn::scan<scn::static_regex_matches<3>>(
+ *     "abc123", "{:/([a-z]+)([0-9]+)/}");
+ * // result->value().size() == 3
+ * \endcode
+ *
+ * \ingroup regex
+ */
+template <typename CharT, std::size_t N>
+class basic_static_regex_matches {
+public:
+    using char_type = CharT;
+    using match_type = basic_regex_match<CharT>;
+    using value_type = std::optional<match_type>;
+    using size_type = std::size_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+    using iterator = value_type*;
+    using const_iterator = const value_type*;
+
+    constexpr basic_static_regex_matches() = default;
+
+    iterator begin()
+    {
+        return m_matches.data();
+    }
+    const_iterator begin() const
+    {
+        return m_matches.data();
+    }
+    iterator end()
+    {
+        return m_matches.data() + m_size;
+    }
+    const_iterator end() const
+    {
+        return m_matches.data() + m_size;
+    }
+
+    pointer data()
+    {
+        return m_matches.data();
+    }
+    const_pointer data() const
+    {
+        return m_matches.data();
+    }
+
+    reference operator[](size_type i)
+    {
+        SCN_EXPECT(i < m_size);
+        return m_matches[i];
+    }
+    const_reference operator[](size_type i) const
+    {
+        SCN_EXPECT(i < m_size);
+        return m_matches[i];
+    }
+
+    SCN_NODISCARD size_type size() const
+    {
+        return m_size;
+    }
+    SCN_NODISCARD bool empty() const
+    {
+        return m_size == 0;
+    }
+    SCN_NODISCARD static constexpr size_type capacity()
+    {
+        return N;
+    }
+
+private:
+    friend struct scanner<basic_static_regex_matches, CharT>;
+
+    std::array<value_type, N> m_matches{};
+    size_type m_size{0};
+};
+
+template <typename CharT, std::size_t N>
+struct scanner<basic_static_regex_matches<CharT, N>, CharT>
+    : scanner<basic_regex_matches<CharT>, CharT> {
+    template <typename Context>
+    scan_expected<typename Context::iterator> scan(
+        basic_static_regex_matches<CharT, N>& val,
+        Context& ctx) const
+    {
+        auto storage = detail::regex_matches_storage<CharT>{
+            val.m_matches.data(), val.m_matches.size()};
+        auto result =
+            detail::scan_regex_matches_into_storage(storage, ctx, this->m_specs);
+        val.m_size = result ? storage.size : 0;
+        return result;
+    }
+};
+
+/**
+ * Statistics of the regex cache of the calling thread.
+ *
+ * Regexes given in format strings (`{:/.../}`) are compiled when scanning,
+ * and kept in a per-thread least-recently-used cache, keyed by the pattern
+ * and the flags. Its size can be set with the `SCN_REGEX_CACHE_SIZE` macro
+ * when building scnlib, and defaults to 16.
+ *
+ * \ingroup regex
+ */
+struct regex_cache_stats {
+    /// Number of times a compiled regex was found in the cache
+    std::size_t hits{0};
+    /// Number of times a regex had to be compiled
+    std::size_t misses{0};
+};
+
+/**
+ * Get the statistics of the regex cache of the calling thread.
+ *
+ * \ingroup regex
+ */
+regex_cache_stats get_regex_cache_stats();
+
 SCN_END_NAMESPACE
 }  // namespace scn
 
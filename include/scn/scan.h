@@ -4408,9 +4408,17 @@ public:
         return sync(0);
     }
 
+    /// If `true`, reading from the underlying source failed, and running
+    /// out of characters was caused by that error, instead of EOF.
+    SCN_NODISCARD virtual bool has_read_error() const
+    {
+        return false;
+    }
+
     SCN_NODISCARD std::ptrdiff_t chars_available() const
     {
-        return static_cast<std::ptrdiff_t>(m_putback_buffer.size() +
+        return m_putback_offset +
+               static_cast<std::ptrdiff_t>(m_putback_buffer.size() +
                                            m_current_view.size());
     }
 
@@ -4428,14 +4436,22 @@ public:
         return m_putback_buffer;
     }
 
+    /// Position of the first character in `putback_buffer()`.
+    /// Non-zero, if characters have been discarded with
+    /// `discard_putback_until()`.
+    SCN_NODISCARD std::ptrdiff_t putback_offset() const
+    {
+        return m_putback_offset;
+    }
+
     SCN_GCC_PUSH
     SCN_GCC_IGNORE("-Warray-bounds")
 
     SCN_NODISCARD std::basic_string_view<CharT> get_segment_starting_at(
         std::ptrdiff_t pos) const
     {
-        SCN_EXPECT(pos >= 0);
-        const auto upos = static_cast<std::size_t>(pos);
+        SCN_EXPECT(pos >= m_putback_offset);
+        const auto upos = static_cast<std::size_t>(pos - m_putback_offset);
         if (SCN_UNLIKELY(upos < m_putback_buffer.size())) {
             return std::basic_string_view<CharT>(m_putback_buffer).substr(upos);
         }
@@ -4446,8 +4462,8 @@ public:
 
     SCN_NODISCARD CharT get_character_at(std::ptrdiff_t pos) const
     {
-        SCN_EXPECT(pos >= 0);
-        const auto upos = static_cast<std::size_t>(pos);
+        SCN_EXPECT(pos >= m_putback_offset);
+        const auto upos = static_cast<std::size_t>(pos - m_putback_offset);
         if (SCN_UNLIKELY(upos < m_putback_buffer.size())) {
             return m_putback_buffer[upos];
         }
@@ -4474,6 +4490,42 @@ public:
     SCN_NODISCARD range_type get();
     SCN_NODISCARD common_range_type get_common_range();
 
+    /// Characters at positions `[first, last)` are known to be validly
+    /// encoded, so that string readers don't need to validate them again.
+    SCN_NODISCARD std::pair<std::ptrdiff_t, std::ptrdiff_t>
+    validated_encoding_range() const
+    {
+        return {m_validated_encoding_first, m_validated_encoding_last};
+    }
+
+    void set_validated_encoding_range(std::ptrdiff_t first,
+                                      std::ptrdiff_t last)
+    {
+        SCN_EXPECT(first <= last);
+        m_validated_encoding_first = first;
+        m_validated_encoding_last = last;
+    }
+
+    /// If `true`, the characters are trusted to be validly encoded,
+    /// and scanning strings from this buffer doesn't validate them.
+    /// Scanning invalid input with this set is undefined behavior.
+    SCN_NODISCARD bool assumes_valid_encoding() const
+    {
+        return m_assume_valid_encoding;
+    }
+
+    void set_assume_valid_encoding(bool value)
+    {
+        m_assume_valid_encoding = value;
+    }
+
+    /// If `true`, scanning a range of this buffer `sync()`s it with the
+    /// position the scan ended at, like scanning the buffer itself does.
+    SCN_NODISCARD bool syncs_after_scanning_range() const
+    {
+        return m_sync_after_scanning_range;
+    }
+
 protected:
     friend class forward_iterator;
     friend class common_forward_iterator;
@@ -4497,9 +4549,44 @@ protected:
     {
     }
 
+    /**
+     * Discards the characters in the putback buffer before `position`,
+     * so that long-lived buffers over streaming sources don't grow without
+     * bound. Positions stay stable: iterators to characters at or after
+     * `position` remain valid.
+     *
+     * The storage is compacted only after at least half of it has become
+     * unused, so that the cost of moving the remaining characters to the
+     * front is amortized.
+     */
+    void discard_putback_until(std::ptrdiff_t position)
+    {
+        if (position <= m_putback_offset) {
+            return;
+        }
+        const auto n = std::min(static_cast<std::size_t>(position -
+                                                         m_putback_offset),
+                                m_putback_buffer.size());
+        if (n < m_putback_buffer.size() / 2) {
+            return;
+        }
+        m_putback_buffer.erase(0, n);
+        m_putback_offset += static_cast<std::ptrdiff_t>(n);
+    }
+
     std::basic_string_view<char_type> m_current_view{};
     std::basic_string<char_type> m_putback_buffer{};
+    std::ptrdiff_t m_putback_offset{0};
     bool m_is_contiguous{false};
+    /// If `false`, advancing an iterator to the end of the available
+    /// characters doesn't `fill()`: it's only done once a character at
+    /// that position is actually needed.
+    bool m_fill_on_advance{true};
+    /// Only set by buffers, for which `sync()` keeps positions stable
+    bool m_sync_after_scanning_range{false};
+    std::ptrdiff_t m_validated_encoding_first{0};
+    std::ptrdiff_t m_validated_encoding_last{0};
+    bool m_assume_valid_encoding{false};
 };
 
 template <typename CharT>
@@ -4566,7 +4653,9 @@ public:
     forward_iterator& operator++()
     {
         ++m_position;
-        (void)read_at_position();
+        if (!stores_parent() || parent()->m_fill_on_advance) {
+            (void)read_at_position();
+        }
         return *this;
     }
 
@@ -4781,6 +4870,13 @@ public:
     {
     }
 
+    basic_scan_string_buffer(std::basic_string_view<CharT> sv,
+                             bool assume_valid_encoding)
+        : base(typename base::contiguous_tag{}, sv)
+    {
+        this->set_assume_valid_encoding(assume_valid_encoding);
+    }
+
     bool fill() override
     {
         SCN_EXPECT(false);
@@ -4806,10 +4902,14 @@ template <typename I, typename S>
 using less_than_compare =
     decltype(SCN_DECLVAL(const I&) < SCN_DECLVAL(const S&));
 
-template <typename Range>
+inline constexpr std::size_t default_forward_buffer_chunk_size = 64;
+
+template <typename Range,
+          std::size_t ChunkSize = default_forward_buffer_chunk_size>
 class basic_scan_forward_buffer_impl
     : public basic_scan_forward_buffer_base<detail::char_t<Range>> {
     static_assert(ranges::range<const Range> && std::is_object_v<Range>);
+    static_assert(ChunkSize > 0);
 
     using _char_type = detail::char_t<Range>;
     using base = basic_scan_forward_buffer_base<_char_type>;
@@ -4820,6 +4920,8 @@ public:
     using iterator = ranges::iterator_t<const Range>;
     using sentinel = ranges::sentinel_t<const Range>;
 
+    static constexpr std::size_t chunk_size = ChunkSize;
+
     template <
         typename R,
         std::enable_if_t<is_not_self<R, basic_scan_forward_buffer_impl> &&
@@ -4832,22 +4934,33 @@ public:
 
     bool fill() override
     {
-        if (m_cursor == ranges::end(*m_range)) {
+        const auto end = ranges::end(*m_range);
+        if (m_cursor == end) {
             return false;
         }
         if constexpr (mp_valid_v<less_than_compare, iterator, sentinel>) {
-            SCN_EXPECT(m_cursor < ranges::end(*m_range));
+            SCN_EXPECT(m_cursor < end);
         }
         if (!this->m_current_view.empty()) {
             this->m_putback_buffer.insert(this->m_putback_buffer.end(),
                                           this->m_current_view.begin(),
                                           this->m_current_view.end());
         }
-        m_latest = *m_cursor;
-        ++m_cursor;
-        this->m_current_view = std::basic_string_view<char_type>{&m_latest, 1};
+
+        // Read ahead up to ChunkSize characters at a time.
+        // The source is a forward range, so reading ahead doesn't consume
+        // anything the result range would need.
+        std::size_t n = 0;
+        do {
+            m_chunk[n] = *m_cursor;
+            ++n;
+            ++m_cursor;
+        } while (n < ChunkSize && m_cursor != end);
+
+        this->m_current_view =
+            std::basic_string_view<char_type>{m_chunk.data(), n};
         if constexpr (mp_valid_v<less_than_compare, iterator, sentinel>) {
-            SCN_EXPECT(m_cursor <= ranges::end(*m_range));
+            SCN_EXPECT(m_cursor <= end);
         }
         return true;
     }
@@ -4855,7 +4968,7 @@ public:
 private:
     const Range* m_range;
     iterator m_cursor;
-    char_type m_latest{};
+    std::array<char_type, ChunkSize> m_chunk{};
 };
 
 template <typename R>
@@ -5201,6 +5314,198 @@ extern template bool basic_scan_file_buffer<stdio_file_interface>::fill();
 extern template bool basic_scan_file_buffer<stdio_file_interface>::sync(
     std::ptrdiff_t);
 
+#if SCN_POSIX
+
+struct posix_fd_interface {
+    explicit constexpr posix_fd_interface(int f) noexcept : fd(f) {}
+
+    /// Reads at most `n` bytes into `buf`, retrying on `EINTR`.
+    /// Returns the number of bytes read, `0` on EOF, or `-1` on error,
+    /// in which case `error` is set to `errno`.
+    SCN_NODISCARD std::ptrdiff_t read(char* buf, std::size_t n);
+
+    int fd;
+    int error{0};
+};
+
+/**
+ * Scan buffer reading from a file descriptor with `read(2)`,
+ * `block_size` bytes at a time.
+ *
+ * Unlike `basic_scan_file_buffer`, no locking or per-character reading
+ * takes place, and characters can't be put back into the file descriptor:
+ * characters read past the end of a scan stay in this buffer.
+ * Thus, the buffer needs to outlive all the scans done through it,
+ * and scanning needs to be done through `get()`:
+ *
+ * \code{.cpp}
+ * auto buffer = scn::make_fd_scan_buffer(fd);
+ * auto result = scn::scan<int>(buffer.get(), "{}");
+ * // continue with result->range()
+ * \endcode
+ *
+ * Every scan through a range of this buffer commits everything before
+ * the position it ended at, like calling `sync()` with the position of
+ * `result->range().begin()` does, allowing the buffer to discard it.
+ * This keeps the memory use of scanning a long stream constant, but
+ * iterators before the end of a scan don't stay valid:
+ * continue from `result->range()`, not from another call to `get()`.
+ *
+ * A failing `read(2)` (e.g. `EAGAIN` on a non-blocking descriptor, or
+ * `ECONNRESET` on a socket) isn't treated as EOF: scans running into it
+ * fail with `scan_error::invalid_source_state`, and `read_error()` gives
+ * its `errno`. The error is sticky: nothing is read after it.
+ */
+template <typename FdInterface>
+class basic_scan_fd_buffer : public basic_scan_buffer<char> {
+    using base = basic_scan_buffer<char>;
+
+public:
+    static constexpr std::size_t default_block_size = 64 * 1024;
+
+    explicit basic_scan_fd_buffer(FdInterface fd,
+                                  std::size_t block_size = default_block_size);
+
+    bool fill() override;
+
+    bool sync(std::ptrdiff_t position) override
+    {
+        this->discard_putback_until(position);
+        return true;
+    }
+
+    SCN_NODISCARD bool has_read_error() const override
+    {
+        return m_read_error != 0;
+    }
+
+    /// `errno` of the failed read, or `0`, if there hasn't been one
+    SCN_NODISCARD int read_error() const
+    {
+        return m_read_error;
+    }
+
+private:
+    FdInterface m_fd;
+    std::string m_block;
+    int m_read_error{0};
+};
+
+SCN_CLANG_PUSH
+SCN_CLANG_IGNORE("-Wweak-vtables")
+
+struct scan_fd_buffer : public basic_scan_fd_buffer<posix_fd_interface> {
+    explicit scan_fd_buffer(int fd, std::size_t block_size = default_block_size)
+        : basic_scan_fd_buffer(posix_fd_interface{fd}, block_size)
+    {
+    }
+};
+
+SCN_CLANG_POP
+
+extern template basic_scan_fd_buffer<posix_fd_interface>::basic_scan_fd_buffer(
+    posix_fd_interface,
+    std::size_t);
+extern template bool basic_scan_fd_buffer<posix_fd_interface>::fill();
+
+#endif  // SCN_POSIX
+
+/**
+ * Scan buffer, into which input is pushed with `feed()`, as it arrives,
+ * instead of being pulled from a source by `fill()`.
+ *
+ * Running out of fed input isn't EOF, unless `finish()` has been called:
+ * `needs_more_input()` tells, whether a scan was cut short by it, and
+ * should be retried after more input has been fed.
+ * Nothing is consumed by such a scan.
+ *
+ * Calling `sync()` consumes the characters before `position`:
+ * positions are relative to the first character not yet consumed,
+ * so iterators into this buffer don't stay valid across scans.
+ *
+ * The input given to `feed()` isn't copied: it needs to stay valid until
+ * the next call to `feed()`. Only the characters of it not yet consumed
+ * are then copied into the putback buffer.
+ */
+template <typename CharT>
+class basic_scan_push_buffer : public basic_scan_buffer<CharT> {
+    using base = basic_scan_buffer<CharT>;
+
+public:
+    basic_scan_push_buffer() : base(typename base::non_contiguous_tag{})
+    {
+        // fill() never gets more input: only ask for it when it's needed,
+        // so that a scan ending at the end of the input can complete
+        this->m_fill_on_advance = false;
+    }
+
+    void feed(std::basic_string_view<CharT> data)
+    {
+        SCN_EXPECT(!m_finished);
+        this->m_putback_buffer.append(this->m_current_view.begin(),
+                                      this->m_current_view.end());
+        this->m_current_view = data;
+    }
+
+    /// No more input is coming: running out of it is now EOF
+    void finish()
+    {
+        m_finished = true;
+    }
+
+    SCN_NODISCARD bool is_finished() const
+    {
+        return m_finished;
+    }
+
+    /// `true`, if the fed input has run out since the last call to
+    /// `clear_reached_end()`, and `finish()` hasn't been called
+    SCN_NODISCARD bool needs_more_input() const
+    {
+        return m_reached_end && !m_finished;
+    }
+
+    void clear_reached_end()
+    {
+        m_reached_end = false;
+    }
+
+    bool fill() override
+    {
+        m_reached_end = true;
+        return false;
+    }
+
+    bool sync(std::ptrdiff_t position) override
+    {
+        if (needs_more_input()) {
+            // The scan will be retried from the start
+            return true;
+        }
+
+        SCN_EXPECT(position >= 0 && position <= this->chars_available());
+        const auto n = static_cast<std::size_t>(position);
+        const auto from_putback = (std::min)(n, this->m_putback_buffer.size());
+        this->m_putback_buffer.erase(0, from_putback);
+        this->m_current_view.remove_prefix(n - from_putback);
+
+        // Positions are relative to the unconsumed input
+        this->m_validated_encoding_first =
+            (std::max)(this->m_validated_encoding_first - position,
+                       std::ptrdiff_t{0});
+        this->m_validated_encoding_last =
+            (std::max)(this->m_validated_encoding_last - position,
+                       this->m_validated_encoding_first);
+        return true;
+    }
+
+private:
+    bool m_reached_end{false};
+    bool m_finished{false};
+};
+
+using scan_push_buffer = basic_scan_push_buffer<char>;
+
 template <typename CharT>
 class basic_scan_ref_buffer : public basic_scan_buffer<CharT> {
     using base = basic_scan_buffer<CharT>;
@@ -5212,8 +5517,9 @@ public:
           m_starting_pos(starting_pos)
     {
         this->m_current_view = other.get_segment_starting_at(starting_pos);
-        m_fill_needs_to_propagate = other.get_segment_starting_at(0).end() ==
-                                    this->m_current_view.end();
+        this->set_assume_valid_encoding(other.assumes_valid_encoding());
+        m_fill_needs_to_propagate =
+            other.current_view().end() == this->m_current_view.end();
     }
 
     basic_scan_ref_buffer(std::basic_string_view<CharT> view)
@@ -5231,8 +5537,22 @@ public:
         if (m_fill_needs_to_propagate) {
             auto ret = m_other->fill();
             this->m_current_view = m_other->current_view();
-            this->m_putback_buffer = m_other->putback_buffer().substr(
-                static_cast<std::size_t>(m_starting_pos));
+
+            // If m_other didn't move its current view into its putback
+            // buffer (e.g. because it reached EOF), m_starting_pos can still
+            // point into the current view
+            const auto& other_putback = m_other->putback_buffer();
+            SCN_EXPECT(m_starting_pos >= m_other->putback_offset());
+            const auto upos = static_cast<std::size_t>(
+                m_starting_pos - m_other->putback_offset());
+            if (upos <= other_putback.size()) {
+                this->m_putback_buffer = other_putback.substr(upos);
+            }
+            else {
+                this->m_putback_buffer.clear();
+                this->m_current_view = this->m_current_view.substr(
+                    upos - other_putback.size());
+            }
             return ret;
         }
 
@@ -5242,6 +5562,19 @@ public:
         return true;
     }
 
+    bool sync(std::ptrdiff_t position) override
+    {
+        if (m_other && m_other->syncs_after_scanning_range()) {
+            return m_other->sync(m_starting_pos + position);
+        }
+        return true;
+    }
+
+    SCN_NODISCARD bool has_read_error() const override
+    {
+        return m_other && m_other->has_read_error();
+    }
+
 private:
     base* m_other;
     std::ptrdiff_t m_starting_pos{-1};
@@ -5273,8 +5606,38 @@ inline auto make_file_scan_buffer(std::FILE* file)
 {
     return scan_file_buffer(file);
 }
+
 }  // namespace detail
 
+#if SCN_POSIX
+/**
+ * Scan buffer reading from a POSIX file descriptor in blocks,
+ * see `detail::basic_scan_fd_buffer`.
+ *
+ * \ingroup scannable
+ */
+using fd_scan_buffer = detail::scan_fd_buffer;
+
+/**
+ * Create a buffer reading from the file descriptor `fd`,
+ * `block_size` bytes at a time. `fd` isn't closed by the buffer.
+ *
+ * \code{.cpp}
+ * auto buffer = scn::make_fd_scan_buffer(fd);
+ * auto result = scn::scan<int>(buffer.get(), "{}");
+ * \endcode
+ *
+ * \ingroup scannable
+ */
+inline auto make_fd_scan_buffer(
+    int fd,
+    std::size_t block_size = fd_scan_buffer::default_block_size)
+    -> fd_scan_buffer
+{
+    return fd_scan_buffer(fd, block_size);
+}
+#endif
+
 /////////////////////////////////////////////////////////////////
 // make_scan_buffer
 /////////////////////////////////////////////////////////////////
@@ -5301,6 +5664,8 @@ inline auto make_file_scan_buffer(std::FILE* file)
  *
  * Additionally, files (`std::FILE*`) can be scanned from.
  * Files are always considered to be narrow (`char`-oriented).
+ * For large files, prefer `scn::mapped_file`, which is a `contiguous_range`,
+ * and thus avoids the buffering done when scanning from a `std::FILE*`.
  * Thus, the entire concept is:
  *
  * \code{.cpp}
@@ -5325,6 +5690,198 @@ struct custom_char_traits : invalid_input_range {};
 struct file_marker_found : invalid_input_range {};
 struct insufficient_range : invalid_input_range {};
 
+/**
+ * A read-only, memory-mapped file.
+ *
+ * Models `contiguous_range` and `sized_range`,
+ * so scanning from a `mapped_file` takes the same path as scanning from a
+ * `std::string_view`: the contents of the file are never copied into an
+ * intermediate buffer, and scanned `std::string_view`s point directly into
+ * the mapping.
+ *
+ * \code{.cpp}
+ * auto file = scn::mapped_file{"data.txt"};
+ * if (!file) {
+ *     // failed to open or map the file
+ * }
+ * auto result = scn::scan<std::string_view>(file, "{}");
+ * // result->value() points into `file`
+ * \endcode
+ *
+ * Only supported on POSIX and Windows.
+ * On other platforms, `valid()` is always `false`.
+ *
+ * \ingroup scannable
+ */
+class mapped_file {
+public:
+    using value_type = char;
+    using iterator = const char*;
+
+    constexpr mapped_file() noexcept = default;
+
+    /// Opens `filename`, and maps its entire contents into memory.
+    /// Check for success with `valid()`.
+    explicit mapped_file(const char* filename);
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    mapped_file(mapped_file&& other) noexcept
+        : m_data(other.m_data), m_size(other.m_size), m_valid(other.m_valid)
+    {
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_valid = false;
+    }
+    mapped_file& operator=(mapped_file&& other) noexcept
+    {
+        if (this != &other) {
+            unmap();
+            m_data = other.m_data;
+            m_size = other.m_size;
+            m_valid = other.m_valid;
+            other.m_data = nullptr;
+            other.m_size = 0;
+            other.m_valid = false;
+        }
+        return *this;
+    }
+
+    ~mapped_file()
+    {
+        unmap();
+    }
+
+    /// `true`, if the file was successfully opened and mapped.
+    /// An empty file is valid, but has no mapping.
+    SCN_NODISCARD constexpr bool valid() const noexcept
+    {
+        return m_valid;
+    }
+    constexpr explicit operator bool() const noexcept
+    {
+        return valid();
+    }
+
+    SCN_NODISCARD constexpr const char* data() const noexcept
+    {
+        return m_data;
+    }
+    SCN_NODISCARD constexpr std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    SCN_NODISCARD constexpr iterator begin() const noexcept
+    {
+        return m_data;
+    }
+    SCN_NODISCARD constexpr iterator end() const noexcept
+    {
+        return m_data + m_size;
+    }
+
+    SCN_NODISCARD constexpr std::string_view view() const noexcept
+    {
+        return {m_data, m_size};
+    }
+
+private:
+    void unmap() noexcept;
+
+    const char* m_data{nullptr};
+    std::size_t m_size{0};
+    bool m_valid{false};
+};
+
+/**
+ * A view of UTF-8 text, that's trusted to be valid, returned by
+ * `assume_valid_utf8()`.
+ *
+ * Scanning from a `valid_utf8_view` takes the same path as scanning from a
+ * `std::string_view`, except that scanned strings aren't validated.
+ *
+ * \ingroup scannable
+ */
+class valid_utf8_view {
+public:
+    using value_type = char;
+    using iterator = const char*;
+
+    constexpr valid_utf8_view() noexcept = default;
+    constexpr explicit valid_utf8_view(std::string_view text) noexcept
+        : m_text(text)
+    {
+    }
+
+    SCN_NODISCARD constexpr const char* data() const noexcept
+    {
+        return m_text.data();
+    }
+    SCN_NODISCARD constexpr std::size_t size() const noexcept
+    {
+        return m_text.size();
+    }
+
+    SCN_NODISCARD constexpr iterator begin() const noexcept
+    {
+        return data();
+    }
+    SCN_NODISCARD constexpr iterator end() const noexcept
+    {
+        return data() + size();
+    }
+
+    SCN_NODISCARD constexpr std::string_view view() const noexcept
+    {
+        return m_text;
+    }
+
+private:
+    std::string_view m_text{};
+};
+
+namespace ranges {
+template <>
+inline constexpr bool enable_borrowed_range<valid_utf8_view> = true;
+}
+
+/**
+ * Marks `source` as valid UTF-8, so that scanning strings from it skips
+ * encoding validation: for input from a producer, that guarantees it
+ * to be valid (or ASCII).
+ *
+ * The returned view refers to `source`, and needs to be scanned from
+ * before `source` is destroyed. Scanning invalid UTF-8 through it is
+ * undefined behavior.
+ *
+ * \code{.cpp}
+ * auto result = scn::scan<std::string>(scn::assume_valid_utf8(input), "{}");
+ * \endcode
+ *
+ * \ingroup scannable
+ */
+SCN_NODISCARD constexpr valid_utf8_view assume_valid_utf8(
+    std::string_view source) noexcept
+{
+    return valid_utf8_view{source};
+}
+
+/// \ingroup scannable
+template <typename Range,
+          std::enable_if_t<ranges::contiguous_range<Range> &&
+                           ranges::sized_range<Range> &&
+                           !std::is_array_v<Range> &&
+                           std::is_same_v<detail::char_t<Range>, char>>* =
+              nullptr>
+SCN_NODISCARD constexpr valid_utf8_view assume_valid_utf8(
+    const Range& source) noexcept
+{
+    return valid_utf8_view{std::string_view{ranges::data(source),
+                                            ranges::size(source)}};
+}
+
 namespace detail {
 template <typename CharT>
 inline constexpr bool is_valid_char_type =
@@ -5350,6 +5907,13 @@ inline auto impl(wscan_buffer::range_type r, priority_tag<4>) noexcept
     return basic_scan_ref_buffer{*r.begin().parent(), r.begin().position()};
 }
 
+// valid_utf8_view -> string_buffer, that assumes valid encoding
+inline auto impl(valid_utf8_view r, priority_tag<4>) noexcept
+    -> basic_scan_string_buffer<char>
+{
+    return basic_scan_string_buffer<char>{r.view(), true};
+}
+
 // string_view -> string_buffer
 template <typename CharT>
 auto impl(std::basic_string_view<CharT> r, priority_tag<3>) noexcept
@@ -7114,16 +7678,151 @@ public:
         return r;
     }
 
-    template <typename CharT>
-    std::basic_string_view<CharT> get_code_units() const
+    template <typename CharT>
+    std::basic_string_view<CharT> get_code_units() const
+    {
+        return {reinterpret_cast<const CharT*>(m_data), m_size};
+    }
+
+private:
+    static constexpr size_t max_size = 4;
+    char m_data[max_size] = {' '};
+    unsigned char m_size{1};
+};
+
+/**
+ * Membership test for the sorted, disjoint non-ASCII code point ranges of a
+ * character set (`{:[...]}`): a two-level bitmap for the BMP,
+ * and a binary search above it.
+ *
+ * Refers to the ranges, which need to outlive it.
+ * Building it costs more than a few lookups, so it's only built once for
+ * a prepared format specifier (see `prepare_format`): other format
+ * specifiers are parsed for every read, and use `ranges_contain`.
+ */
+class charset_nonascii_lookup {
+public:
+    charset_nonascii_lookup(const std::pair<char32_t, char32_t>* ranges,
+                            std::size_t size)
+        : m_ranges(ranges), m_ranges_size(size)
+    {
+        for (auto r = ranges; r != ranges + size && r->first < bmp_end; ++r) {
+            const auto last = detail::min(static_cast<uint32_t>(r->second),
+                                         bmp_end);
+            for (auto cp = static_cast<uint32_t>(r->first); cp < last;) {
+                const auto block = cp / block_size;
+                const auto block_first = block * block_size;
+                const auto seg_last =
+                    detail::min(last, block_first + block_size);
+                if (cp == block_first && seg_last == block_first + block_size) {
+                    m_blocks[block] = block_all;
+                }
+                else {
+                    set_partial_block(block, cp - block_first,
+                                      seg_last - block_first);
+                }
+                cp = seg_last;
+            }
+        }
+    }
+
+    SCN_NODISCARD bool contains(char32_t cp) const
+    {
+        const auto cp_val = static_cast<uint32_t>(cp);
+        if (cp_val < bmp_end) {
+            const auto block = m_blocks[cp_val / block_size];
+            if (block < block_search) {
+                return block == block_all;
+            }
+            if (block > block_search) {
+                const auto& leaf = m_leaves[block - block_leaf_first];
+                const auto i = cp_val % block_size;
+                return (leaf[i / 64] >> (i % 64)) & 1u;
+            }
+        }
+
+        return ranges_contain(m_ranges, m_ranges_size, cp);
+    }
+
+    /// Search for `cp` in `ranges`, without a lookup
+    SCN_NODISCARD static bool ranges_contain(
+        const std::pair<char32_t, char32_t>* ranges,
+        std::size_t size,
+        char32_t cp)
+    {
+        const auto cp_val = static_cast<uint32_t>(cp);
+        if (size <= max_linear_search_size) {
+            // Predictable: faster than a binary search for a few ranges
+            for (auto r = ranges; r != ranges + size; ++r) {
+                if (static_cast<uint32_t>(r->first) <= cp_val &&
+                    cp_val < static_cast<uint32_t>(r->second)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Find the last range starting at or before cp, without branching
+        auto base = ranges;
+        while (size > 1) {
+            const auto half = size / 2;
+            base = static_cast<uint32_t>(base[half].first) <= cp_val
+                       ? base + half
+                       : base;
+            size -= half;
+        }
+        return static_cast<uint32_t>(base->first) <= cp_val &&
+               cp_val < static_cast<uint32_t>(base->second);
+    }
+
+private:
+    static constexpr uint32_t bmp_end = 0x10000;
+    static constexpr uint32_t block_size = 256;
+    // Leaves are kept inline, so that building the lookup never allocates:
+    // partially covered blocks beyond these fall back to the binary search
+    static constexpr std::size_t max_leaves = 8;
+    static constexpr std::size_t max_linear_search_size = 16;
+
+    enum : uint8_t {
+        block_none = 0,
+        block_all = 1,
+        block_search = 2,
+        block_leaf_first = 3,
+    };
+
+    void set_partial_block(uint32_t block, uint32_t first, uint32_t last)
     {
-        return {reinterpret_cast<const CharT*>(m_data), m_size};
+        auto& state = m_blocks[block];
+        if (state == block_search) {
+            return;
+        }
+        if (state == block_none) {
+            if (m_leaves_size == max_leaves) {
+                state = block_search;
+                return;
+            }
+            m_leaves[m_leaves_size] = {};
+            state = static_cast<uint8_t>(block_leaf_first + m_leaves_size);
+            ++m_leaves_size;
+        }
+
+        auto& leaf = m_leaves[state - block_leaf_first];
+        for (auto i = first; i < last;) {
+            const auto bit = i % 64;
+            const auto n = detail::min(last - i, 64 - bit);
+            const auto mask = n == 64 ? ~uint64_t{0}
+                                      : ((uint64_t{1} << n) - 1) << bit;
+            leaf[i / 64] |= mask;
+            i += n;
+        }
     }
 
-private:
-    static constexpr size_t max_size = 4;
-    char m_data[max_size] = {' '};
-    unsigned char m_size{1};
+    std::array<uint8_t, bmp_end / block_size> m_blocks{};
+    // Only the first m_leaves_size are initialized
+    std::array<std::array<uint64_t, block_size / 64>, max_leaves> m_leaves;
+    std::size_t m_leaves_size{0};
+    const std::pair<char32_t, char32_t>* m_ranges;
+    std::size_t m_ranges_size;
 };
 
 struct format_specs {
@@ -7134,6 +7833,12 @@ struct format_specs {
     bool charset_has_nonascii{false}, charset_is_inverted{false};
     const void* charset_string_data{nullptr};
     size_t charset_string_size{0};
+    // Sorted, disjoint non-ASCII code point ranges [first, second) of the
+    // character set, if already parsed (see `prepared_format`)
+    const std::pair<char32_t, char32_t>* charset_nonascii_ranges{nullptr};
+    size_t charset_nonascii_ranges_size{0};
+    // Lookup built from charset_nonascii_ranges, if already built
+    const charset_nonascii_lookup* charset_lookup{nullptr};
 #if !SCN_DISABLE_REGEX
     regex_flags regexp_flags{regex_flags::none};
 #endif
@@ -9174,7 +9879,8 @@ namespace detail {
 template <typename T, typename ParseCtx>
 constexpr typename ParseCtx::iterator scanner_parse_for_builtin_type(
     ParseCtx& pctx,
-    format_specs& specs);
+    format_specs& specs,
+    scan_expected<void>* error = nullptr);
 
 template <typename T, typename Context>
 scan_expected<typename Context::iterator>
@@ -9220,7 +9926,8 @@ namespace detail {
 template <typename T, typename ParseCtx>
 constexpr typename ParseCtx::iterator scanner_parse_for_builtin_type(
     ParseCtx& pctx,
-    format_specs& specs)
+    format_specs& specs,
+    scan_expected<void>* error)
 {
     using char_type = typename ParseCtx::char_type;
 
@@ -9314,6 +10021,11 @@ constexpr typename ParseCtx::iterator scanner_parse_for_builtin_type(
     }
 #endif
 
+    if (error) {
+        if (auto e = checker.get_error(); SCN_UNLIKELY(!e)) {
+            *error = e;
+        }
+    }
     return it;
 }
 }  // namespace detail
@@ -9613,6 +10325,242 @@ constexpr R basic_scan_arg<Context>::visit(Visitor&& vis)
     return detail::visit_impl(SCN_FWD(vis), *this);
 }
 
+/////////////////////////////////////////////////////////////////
+// Compiled format strings
+/////////////////////////////////////////////////////////////////
+
+namespace detail {
+struct compiled_string : compile_string {};
+
+template <typename Str>
+inline constexpr bool is_compiled_string_v =
+    std::is_base_of_v<compiled_string, Str>;
+
+/// A single step of a compiled format string
+template <typename CharT>
+struct compiled_format_op {
+    enum class kind_type : unsigned char {
+        literal,        // match `text` in the source
+        default_field,  // `{}`: read argument `arg_id` with default options
+        specs_field,    // `{:...}`: read argument `arg_id` with `specs`
+        custom_field,   // `{:...}` of a user type: `text` starts at the
+                        // specs, which are parsed by its scanner at runtime
+    };
+
+    kind_type kind{kind_type::literal};
+    std::basic_string_view<CharT> text{};
+    std::size_t arg_id{0};
+    format_specs specs{};
+};
+
+/// Type-erased view of the steps of a compiled format string
+template <typename CharT>
+struct compiled_format_view {
+    std::basic_string_view<CharT> str{};
+    const compiled_format_op<CharT>* ops{nullptr};
+    std::size_t size{0};
+};
+
+template <typename T, typename CharT>
+constexpr const CharT* parse_compiled_format_specs(
+    compile_parse_context<CharT>& parse_ctx,
+    format_specs& specs)
+{
+    using map_result = std::remove_reference_t<decltype(arg_mapper<CharT>().map(
+        SCN_DECLVAL(T&)))>;
+    if constexpr (arg_type_constant<T, CharT>::value == arg_type::custom_type ||
+                  std::is_base_of_v<unscannable, map_result>) {
+        // Only find the end of the specs, these are parsed at runtime
+        SCN_UNUSED(specs);
+        return parse_format_specs<T, default_context<CharT>>(parse_ctx);
+    }
+    else {
+        // Errors in the specs fail to compile in a constant expression,
+        // so this is only reported for a `prepared_format`
+        scan_expected<void> error{};
+        const auto it = scanner_parse_for_builtin_type<map_result>(
+            parse_ctx, specs, &error);
+        if (SCN_UNLIKELY(!error)) {
+            parse_ctx.on_error(error.error().msg());
+        }
+        return it;
+    }
+}
+
+/**
+ * Format string handler, which records the literal text and the replacement
+ * fields of a format string into `compiled_format_op`s, instead of
+ * scanning.
+ *
+ * If `ops` is `nullptr`, only counts them.
+ * The format string is expected to have already been checked with
+ * `format_string_checker`.
+ */
+template <typename CharT, typename Source, typename... Args>
+class compiled_format_builder {
+public:
+    using parse_context_type = compile_parse_context<CharT>;
+    using op_type = compiled_format_op<CharT>;
+    static constexpr auto num_args = sizeof...(Args);
+
+    constexpr compiled_format_builder(std::basic_string_view<CharT> format_str,
+                                      op_type* ops)
+        : m_parse_context(source_tag<Source>, format_str, num_args, m_types),
+          m_parse_funcs{&parse_compiled_format_specs<Args, CharT>...},
+          m_types{arg_type_constant<Args, CharT>::value...},
+          m_ops(ops)
+    {
+    }
+
+    constexpr void on_literal_text(const CharT* begin, const CharT* end)
+    {
+        if (begin == end) {
+            return;
+        }
+
+        op_type op{};
+        op.text = {begin, static_cast<std::size_t>(end - begin)};
+        push(op);
+    }
+
+    constexpr auto on_arg_id()
+    {
+        return m_parse_context.next_arg_id();
+    }
+    constexpr auto on_arg_id(std::size_t id)
+    {
+        m_parse_context.check_arg_id(id);
+        return id;
+    }
+
+    constexpr void on_replacement_field(std::size_t id, const CharT*)
+    {
+        op_type op{};
+        op.kind = op_type::kind_type::default_field;
+        op.arg_id = id;
+        push(op);
+    }
+
+    constexpr const CharT* on_format_specs(std::size_t id,
+                                           const CharT* begin,
+                                           const CharT* end)
+    {
+        if (id >= num_args) {
+            on_error("Invalid out-of-range argument ID");
+            return begin;
+        }
+
+        op_type op{};
+        op.arg_id = id;
+        if (m_types[id] == arg_type::custom_type) {
+            op.kind = op_type::kind_type::custom_field;
+            op.text = {begin, static_cast<std::size_t>(end - begin)};
+        }
+        else {
+            op.kind = op_type::kind_type::specs_field;
+        }
+
+        m_parse_context.advance_to(begin);
+        const auto it = m_parse_funcs[id](m_parse_context, op.specs);
+        push(op);
+        return it;
+    }
+
+    constexpr void check_args_exhausted() {}
+
+    void on_error(const char* msg)
+    {
+        SCN_UNLIKELY_ATTR
+        m_parse_context.on_error(msg);
+    }
+
+    constexpr scan_expected<void> get_error() const
+    {
+        return {};
+    }
+
+    SCN_NODISCARD constexpr std::size_t size() const
+    {
+        return m_size;
+    }
+
+protected:
+    constexpr void push(const op_type& op)
+    {
+        if (m_ops) {
+            m_ops[m_size] = op;
+        }
+        ++m_size;
+    }
+
+    using parse_func = const CharT* (*)(parse_context_type&, format_specs&);
+
+    parse_context_type m_parse_context;
+    parse_func m_parse_funcs[num_args > 0 ? num_args : 1];
+    arg_type m_types[num_args > 0 ? num_args : 1];
+    op_type* m_ops;
+    std::size_t m_size{0};
+};
+}  // namespace detail
+
+/**
+ * A format string, parsed at compile time into a sequence of literal text
+ * and replacement fields, with the format specifiers of every built-in
+ * type already parsed.
+ *
+ * Scanning with it doesn't need to parse the format string at runtime at
+ * all. Created implicitly by `scan` when it's given a format string wrapped
+ * in `SCN_COMPILE`, so there's rarely a need to name this type directly.
+ *
+ * \ingroup format-string
+ */
+template <typename Str, typename Source, typename... Args>
+class compiled_format {
+public:
+    using char_type = typename Str::char_type;
+    using op_type = detail::compiled_format_op<char_type>;
+
+    SCN_GCC_PUSH
+    SCN_GCC_IGNORE("-Wconversion")
+    static constexpr auto str = std::basic_string_view<char_type>{Str{}};
+    SCN_GCC_POP
+
+    static constexpr std::size_t size = [] {
+        auto builder =
+            detail::compiled_format_builder<char_type, Source, Args...>{
+                str, nullptr};
+        detail::parse_format_string<true>(str, builder);
+        return builder.size();
+    }();
+
+    static constexpr std::array<op_type, size> ops = [] {
+        std::array<op_type, size> result{};
+        auto builder =
+            detail::compiled_format_builder<char_type, Source, Args...>{
+                str, result.data()};
+        detail::parse_format_string<true>(str, builder);
+        return result;
+    }();
+
+    static constexpr detail::compiled_format_view<char_type> view()
+    {
+        return {str, ops.data(), ops.size()};
+    }
+};
+
+/**
+ * Mark a format string to be compiled:
+ * see `compiled_format`.
+ *
+ * \code{.cpp}
+ * auto result = scn::scan<int, double>(source, SCN_COMPILE("{} {:a}"));
+ * \endcode
+ *
+ * \ingroup format-string
+ */
+#define SCN_COMPILE(s) \
+    SCN_STRING_IMPL(s, ::scn::detail::compiled_string, explicit)
+
 /////////////////////////////////////////////////////////////////
 // vscan
 /////////////////////////////////////////////////////////////////
@@ -9736,6 +10684,30 @@ auto vscan_localized_generic(
 #endif
 }
 
+scan_expected<std::ptrdiff_t> vscan_compiled_impl(
+    std::string_view source,
+    compiled_format_view<char> format,
+    scan_args args);
+scan_expected<std::ptrdiff_t> vscan_compiled_impl(
+    scan_buffer& source,
+    compiled_format_view<char> format,
+    scan_args args);
+
+template <typename Range, typename CharT>
+auto vscan_compiled_generic(Range&& range,
+                            compiled_format_view<CharT> format,
+                            basic_scan_args<detail::default_context<CharT>> args)
+    -> vscan_result<Range>
+{
+    auto buffer = make_scan_buffer(range);
+
+    auto result = vscan_compiled_impl(buffer, format, args);
+    if (SCN_UNLIKELY(!result)) {
+        return unexpected(result.error());
+    }
+    return make_vscan_result_range(SCN_FWD(range), *result);
+}
+
 template <typename Range, typename CharT>
 auto vscan_value_generic(Range&& range,
                          basic_scan_arg<detail::default_context<CharT>> arg)
@@ -9806,7 +10778,47 @@ auto vscan_value(Source&& source, basic_scan_arg<scan_context> arg)
  */
 scan_expected<void> vinput(std::string_view format, scan_args args);
 
+/**
+ * Error returned by `scan_ints` and `scan_floats`.
+ *
+ * In addition to the `scan_error` itself, tells how many values were
+ * written into the output range before the error, and where in the source
+ * the value that couldn't be read begins.
+ *
+ * \ingroup result
+ */
+class scan_sequence_error : public scan_error {
+public:
+    constexpr scan_sequence_error(scan_error e,
+                                  std::size_t count,
+                                  std::string_view::iterator position) noexcept
+        : scan_error(e), m_position(position), m_count(count)
+    {
+    }
+
+    /// Number of values read and written into the output range
+    /// before the error
+    SCN_NODISCARD constexpr std::size_t count() const noexcept
+    {
+        return m_count;
+    }
+    /// Position in the source of the value that couldn't be read
+    SCN_NODISCARD constexpr std::string_view::iterator position()
+        const noexcept
+    {
+        return m_position;
+    }
+
+private:
+    std::string_view::iterator m_position;
+    std::size_t m_count;
+};
+
 namespace detail {
+using scan_sequence_expected =
+    expected<std::pair<std::string_view::iterator, std::size_t>,
+             scan_sequence_error>;
+
 template <typename T>
 auto scan_int_impl(std::string_view source, T& value, int base)
     -> scan_expected<std::string_view::iterator>;
@@ -9814,11 +10826,30 @@ auto scan_int_impl(std::string_view source, T& value, int base)
 template <typename T>
 auto scan_int_exhaustive_valid_impl(std::string_view source) -> T;
 
+template <typename T>
+auto scan_ints_impl(std::string_view source,
+                    T* out,
+                    std::size_t count,
+                    char separator)
+    -> scan_sequence_expected;
+
+template <typename T>
+auto scan_floats_impl(std::string_view source,
+                      T* out,
+                      std::size_t count,
+                      char separator)
+    -> scan_sequence_expected;
+
 #if !SCN_DISABLE_TYPE_SCHAR
 extern template auto scan_int_impl(std::string_view source,
                                    signed char& value,
                                    int base)
     -> scan_expected<std::string_view::iterator>;
+extern template auto scan_ints_impl(std::string_view source,
+                                    signed char* out,
+                                    std::size_t count,
+                                    char separator)
+    -> scan_sequence_expected;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view)
     -> signed char;
 #endif
@@ -9827,6 +10858,11 @@ extern template auto scan_int_impl(std::string_view source,
                                    short& value,
                                    int base)
     -> scan_expected<std::string_view::iterator>;
+extern template auto scan_ints_impl(std::string_view source,
+                                    short* out,
+                                    std::size_t count,
+                                    char separator)
+    -> scan_sequence_expected;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view) -> short;
 #endif
 #if !SCN_DISABLE_TYPE_INT
@@ -9834,6 +10870,11 @@ extern template auto scan_int_impl(std::string_view source,
                                    int& value,
                                    int base)
     -> scan_expected<std::string_view::iterator>;
+extern template auto scan_ints_impl(std::string_view source,
+                                    int* out,
+                                    std::size_t count,
+                                    char separator)
+    -> scan_sequence_expected;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view) -> int;
 #endif
 #if !SCN_DISABLE_TYPE_LONG
@@ -9841,6 +10882,11 @@ extern template auto scan_int_impl(std::string_view source,
                                    long& value,
                                    int base)
     -> scan_expected<std::string_view::iterator>;
+extern template auto scan_ints_impl(std::string_view source,
+                                    long* out,
+                                    std::size_t count,
+                                    char separator)
+    -> scan_sequence_expected;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view) -> long;
 #endif
 #if !SCN_DISABLE_TYPE_LONG_LONG
@@ -9848,6 +10894,11 @@ extern template auto scan_int_impl(std::string_view source,
                                    long long& value,
                                    int base)
     -> scan_expected<std::string_view::iterator>;
+extern template auto scan_ints_impl(std::string_view source,
+                                    long long* out,
+                                    std::size_t count,
+                                    char separator)
+    -> scan_sequence_expected;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view)
     -> long long;
 #endif
@@ -9856,6 +10907,11 @@ extern template auto scan_int_impl(std::string_view source,
                                    unsigned char& value,
                                    int base)
     -> scan_expected<std::string_view::iterator>;
+extern template auto scan_ints_impl(std::string_view source,
+                                    unsigned char* out,
+                                    std::size_t count,
+                                    char separator)
+    -> scan_sequence_expected;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view)
     -> unsigned char;
 #endif
@@ -9864,6 +10920,11 @@ extern template auto scan_int_impl(std::string_view source,
                                    unsigned short& value,
                                    int base)
     -> scan_expected<std::string_view::iterator>;
+extern template auto scan_ints_impl(std::string_view source,
+                                    unsigned short* out,
+                                    std::size_t count,
+                                    char separator)
+    -> scan_sequence_expected;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view)
     -> unsigned short;
 #endif
@@ -9872,6 +10933,11 @@ extern template auto scan_int_impl(std::string_view source,
                                    unsigned int& value,
                                    int base)
     -> scan_expected<std::string_view::iterator>;
+extern template auto scan_ints_impl(std::string_view source,
+                                    unsigned int* out,
+                                    std::size_t count,
+                                    char separator)
+    -> scan_sequence_expected;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view)
     -> unsigned int;
 #endif
@@ -9880,6 +10946,11 @@ extern template auto scan_int_impl(std::string_view source,
                                    unsigned long& value,
                                    int base)
     -> scan_expected<std::string_view::iterator>;
+extern template auto scan_ints_impl(std::string_view source,
+                                    unsigned long* out,
+                                    std::size_t count,
+                                    char separator)
+    -> scan_sequence_expected;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view)
     -> unsigned long;
 #endif
@@ -9888,6 +10959,11 @@ extern template auto scan_int_impl(std::string_view source,
                                    unsigned long long& value,
                                    int base)
     -> scan_expected<std::string_view::iterator>;
+extern template auto scan_ints_impl(std::string_view source,
+                                    unsigned long long* out,
+                                    std::size_t count,
+                                    char separator)
+    -> scan_sequence_expected;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view)
     -> unsigned long long;
 #endif
@@ -9899,6 +10975,11 @@ extern template auto scan_int_impl(std::string_view source,
                                    int128& value,
                                    int base)
     -> scan_expected<std::string_view::iterator>;
+extern template auto scan_ints_impl(std::string_view source,
+                                    int128* out,
+                                    std::size_t count,
+                                    char separator)
+    -> scan_sequence_expected;
 #endif
 
 #if !SCN_DISABLE_TYPE_UINT128
@@ -9906,10 +10987,37 @@ extern template auto scan_int_impl(std::string_view source,
                                    uint128& value,
                                    int base)
     -> scan_expected<std::string_view::iterator>;
+extern template auto scan_ints_impl(std::string_view source,
+                                    uint128* out,
+                                    std::size_t count,
+                                    char separator)
+    -> scan_sequence_expected;
 #endif
 
 #endif  // SCN_HAS_INT128
 
+#if !SCN_DISABLE_TYPE_FLOAT
+extern template auto scan_floats_impl(std::string_view source,
+                                      float* out,
+                                      std::size_t count,
+                                      char separator)
+    -> scan_sequence_expected;
+#endif
+#if !SCN_DISABLE_TYPE_DOUBLE
+extern template auto scan_floats_impl(std::string_view source,
+                                      double* out,
+                                      std::size_t count,
+                                      char separator)
+    -> scan_sequence_expected;
+#endif
+#if !SCN_DISABLE_TYPE_LONG_DOUBLE
+extern template auto scan_floats_impl(std::string_view source,
+                                      long double* out,
+                                      std::size_t count,
+                                      char separator)
+    -> scan_sequence_expected;
+#endif
+
 }  // namespace detail
 
 SCN_GCC_POP  // -Wnoexcept
@@ -10040,6 +11148,43 @@ SCN_NODISCARD auto scan(Source&& source,
     return result;
 }
 
+/**
+ * `scan` with a compiled format string.
+ *
+ * The format string is parsed at compile time,
+ * and no format string parsing is done at runtime.
+ * Useful when the same format string is used to scan a lot of input,
+ * e.g. line by line.
+ *
+ * \code{.cpp}
+ * auto result = scn::scan<int, int>("123 456", SCN_COMPILE("{} {}"));
+ * auto [a, b] = result->values();
+ * \endcode
+ *
+ * \ingroup scan
+ */
+template <typename... Args,
+          typename Source,
+          typename Str,
+          typename = std::enable_if_t<detail::is_file_or_narrow_range<Source> &&
+                                      detail::is_compiled_string_v<Str>>>
+SCN_NODISCARD auto scan(Source&& source, Str format)
+    -> scan_result_type<Source, Args...>
+{
+    static_assert(std::is_same_v<typename Str::char_type, char>,
+                  "Compiled format strings are only supported with narrow "
+                  "format strings and sources");
+
+    detail::check_format_string<Source, Args...>(format);
+    using compiled_type = compiled_format<Str, Source, Args...>;
+
+    auto result = make_scan_result<Source, Args...>();
+    fill_scan_result(result, detail::vscan_compiled_generic(
+                                 SCN_FWD(source), compiled_type::view(),
+                                 scan_args{make_scan_args(result->values())}));
+    return result;
+}
+
 /**
  * \defgroup locale Localization
  *
@@ -10216,6 +11361,145 @@ SCN_NODISCARD auto scan_int(std::string_view source, int base = 10)
     return result;
 }
 
+namespace detail {
+// Element type of a writable contiguous range, or void
+template <typename Range, typename = void>
+struct scan_sequence_output_value {
+    using type = void;
+};
+
+template <typename Range>
+struct scan_sequence_output_value<
+    Range,
+    std::enable_if_t<ranges::contiguous_range<Range> &&
+                     ranges::sized_range<Range>>> {
+    using pointee_type =
+        std::remove_pointer_t<decltype(ranges::data(std::declval<Range&>()))>;
+    using type =
+        std::conditional_t<std::is_const_v<pointee_type>, void, pointee_type>;
+};
+
+template <typename Range>
+using scan_sequence_output_value_t =
+    typename scan_sequence_output_value<Range>::type;
+
+template <typename T>
+inline constexpr bool is_scan_float_type =
+    std::is_same_v<T, float> || std::is_same_v<T, double> ||
+    std::is_same_v<T, long double>;
+}  // namespace detail
+
+/**
+ * The return type of `scan_ints` and `scan_floats`.
+ * On success, contains the number of values read, and the rest of the
+ * source. On error, contains a `scan_sequence_error`.
+ */
+using scan_sequence_result_type =
+    expected<scan_result<detail::scan_result_value_type<std::string_view>,
+                         std::size_t>,
+             scan_sequence_error>;
+
+/**
+ * Batch integer reading.
+ *
+ * Reads base-10 integers from `source` into the contiguous range `out`
+ * (e.g. a `std::span<T>`, a `std::vector<T>`, or a `std::array<T, N>`),
+ * in a single call, without going through the format string machinery for
+ * every element. Whitespace before the first integer and around each
+ * separator is skipped. If `separator` is a whitespace character (the
+ * default), any run of whitespace separates two integers.
+ *
+ * Reading stops when `out` is full, or when the input after the last read
+ * integer doesn't continue with a separator followed by an integer.
+ * The returned value is the number of integers written into `out`, and the
+ * returned range starts right after the last read integer.
+ *
+ * Fails if the first integer can't be read, or if any of the read integers
+ * is out of range for `T`. The returned `scan_sequence_error` tells how
+ * many integers were written into `out` before the error, and where in
+ * `source` the integer that failed begins. The element of `out` right
+ * after those may have been overwritten.
+ *
+ * \code{.cpp}
+ * std::vector<int> values(1000);
+ * auto result = scn::scan_ints("1 2 3", values);
+ * // result->value() == 3
+ * // values[0] == 1, values[1] == 2, values[2] == 3
+ *
+ * result = scn::scan_ints("1 2 99999999999 4", values);
+ * // result.error().code() == scn::scan_error::value_positive_overflow
+ * // result.error().count() == 2
+ * // result.error().position() points to "99999999999 4"
+ * \endcode
+ *
+ * \ingroup scan
+ */
+template <typename Range,
+          std::enable_if_t<detail::is_scan_int_type<
+              detail::scan_sequence_output_value_t<Range>>>* = nullptr>
+SCN_NODISCARD auto scan_ints(std::string_view source,
+                             Range&& out,
+                             char separator = ' ')
+    -> scan_sequence_result_type
+{
+    auto result = scan_sequence_result_type();
+    if (auto r = detail::scan_ints_impl(
+            source, ranges::data(out),
+            static_cast<std::size_t>(ranges::size(out)), separator);
+        SCN_LIKELY(r)) {
+        result->set_range(ranges::subrange{r->first, source.end()});
+        result->value() = r->second;
+    }
+    else {
+        result = unexpected(r.error());
+    }
+    return result;
+}
+
+/**
+ * Batch floating-point reading.
+ *
+ * Reads floating-point values from `source` into the contiguous range
+ * `out`, like `scan_ints`. The values are read with the same rules as
+ * `scan<T>(source, "{}")`, including hexfloats, infinities and NaNs,
+ * without going through the format string machinery for every element.
+ *
+ * Reading stops when `out` is full, or when the input after the last read
+ * value doesn't continue with a separator followed by a value.
+ * The returned value is the number of values written into `out`, and the
+ * returned range starts right after the last read value.
+ *
+ * Fails if the first value can't be read, or if something starting like a
+ * value after a separator (a sign, a digit, a `.`, or the start of "inf" or
+ * "nan") isn't a valid value, or is out of range for `T`. Like with
+ * `scan_ints`, the returned `scan_sequence_error` tells how many values
+ * were written into `out` before the error, and where in `source` the value
+ * that failed begins.
+ *
+ * \ingroup scan
+ */
+template <typename Range,
+          std::enable_if_t<detail::is_scan_float_type<
+              detail::scan_sequence_output_value_t<Range>>>* = nullptr>
+SCN_NODISCARD auto scan_floats(std::string_view source,
+                               Range&& out,
+                               char separator = ' ')
+    -> scan_sequence_result_type
+{
+    auto result = scan_sequence_result_type();
+    if (auto r = detail::scan_floats_impl(
+            source, ranges::data(out),
+            static_cast<std::size_t>(ranges::size(out)), separator);
+        SCN_LIKELY(r)) {
+        result->set_range(ranges::subrange{r->first, source.end()});
+        result->value() = r->second;
+    }
+    else {
+        result = unexpected(r.error());
+    }
+    return result;
+}
+
 namespace detail {
 template <bool Val, typename T>
 inline constexpr bool dependent_bool = Val;
@@ -17,6 +17,13 @@
 
 #include <scn/chrono.h>
 #include <scn/impl.h>
+#include <scn/parallel.h>
+#include <scn/prepared.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 #if !SCN_DISABLE_LOCALE
 #include <locale>
@@ -88,6 +95,13 @@ SCN_GCC_POP
 #if !((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ > 25)))
 #include <xlocale.h>
 #define SCN_XLOCALE SCN_XLOCALE_POSIX
+#elif defined(__USE_GNU)
+// glibc 2.26 removed <xlocale.h>,
+// newlocale and strtod_l & co. are declared in the standard headers
+#include <locale.h>
+#include <stdlib.h>
+#include <wchar.h>
+#define SCN_XLOCALE SCN_XLOCALE_POSIX
 #endif  // __GLIBC__ <= 2.25
 
 #elif defined(__FreeBSD_version) && __FreeBSD_version >= 1000010
@@ -102,6 +116,70 @@ SCN_GCC_POP
 #define SCN_XLOCALE SCN_XLOCALE_OTHER
 #endif
 
+#if SCN_POSIX
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#elif SCN_WINDOWS
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+#if SCN_X86_64 && (SCN_GCC_COMPAT || SCN_MSVC)
+#define SCN_HAS_X86_SIMD_KERNELS 1
+#include <immintrin.h>
+#if SCN_MSVC
+#include <intrin.h>
+#endif
+#elif SCN_ARM64 && (defined(__ARM_NEON) || SCN_MSVC)
+#define SCN_HAS_NEON_KERNELS 1
+#include <arm_neon.h>
+#endif
+
+#ifndef SCN_HAS_X86_SIMD_KERNELS
+#define SCN_HAS_X86_SIMD_KERNELS 0
+#endif
+#ifndef SCN_HAS_NEON_KERNELS
+#define SCN_HAS_NEON_KERNELS 0
+#endif
+
+// SSE2 is a part of x86-64, AVX2 and AVX-512 kernels are compiled
+// separately, and selected at runtime, see get_kernel_dispatch_table()
+#if SCN_CLANG
+#define SCN_TARGET_AVX2_BEGIN \
+    _Pragma(                  \
+        "clang attribute push(__attribute__((target(\"avx2\"))), apply_to = function)")
+#define SCN_TARGET_AVX2_END _Pragma("clang attribute pop")
+#elif SCN_GCC_COMPAT
+#define SCN_TARGET_AVX2_BEGIN \
+    _Pragma("GCC push_options") _Pragma("GCC target(\"avx2\")")
+#define SCN_TARGET_AVX2_END _Pragma("GCC pop_options")
+#else
+#define SCN_TARGET_AVX2_BEGIN
+#define SCN_TARGET_AVX2_END
+#endif
+
+#if SCN_CLANG
+#define SCN_TARGET_AVX512BW_BEGIN \
+    _Pragma(                      \
+        "clang attribute push(__attribute__((target(\"avx512f,avx512bw\"))), apply_to = function)")
+#define SCN_TARGET_AVX512BW_END _Pragma("clang attribute pop")
+#elif SCN_GCC_COMPAT
+#define SCN_TARGET_AVX512BW_BEGIN \
+    _Pragma("GCC push_options") _Pragma("GCC target(\"avx512f,avx512bw\")")
+#define SCN_TARGET_AVX512BW_END _Pragma("GCC pop_options")
+#else
+#define SCN_TARGET_AVX512BW_BEGIN
+#define SCN_TARGET_AVX512BW_END
+#endif
+
 namespace scn {
 SCN_BEGIN_NAMESPACE
 
@@ -111,55 +189,6 @@ SCN_BEGIN_NAMESPACE
 
 namespace impl {
 namespace {
-template <typename R>
-bool has_nonascii_char_64(R source)
-{
-    static_assert(sizeof(*source.data()) == 1);
-    SCN_EXPECT(source.size() <= 8);
-    uint64_t word{};
-    std::memcpy(&word, source.data(), source.size());
-
-    return has_byte_greater(word, 127) != 0;
-}
-
-template <typename CuCb, typename CpCb>
-std::string_view::iterator find_classic_impl(std::string_view source,
-                                             CuCb cu_cb,
-                                             CpCb cp_cb)
-{
-    auto it = source.begin();
-
-    while (it != source.end()) {
-        auto sv =
-            detail::make_string_view_from_iterators<char>(it, source.end())
-                .substr(0, 8);
-
-        if (!has_nonascii_char_64(sv)) {
-            auto tmp_it = std::find_if(sv.begin(), sv.end(), cu_cb);
-            it = detail::make_string_view_iterator(source, tmp_it);
-            if (tmp_it != sv.end()) {
-                break;
-            }
-            continue;
-        }
-
-        for (std::size_t i = 0; i < sv.size(); ++i) {
-            auto tmp =
-                detail::make_string_view_from_iterators<char>(it, source.end());
-            auto res = get_next_code_point(tmp);
-            if (cp_cb(res.value)) {
-                return it;
-            }
-            i += static_cast<std::size_t>(
-                ranges::distance(tmp.data(), detail::to_address(res.iterator)));
-            it = detail::make_string_view_iterator(source, res.iterator);
-            SCN_ENSURE(it <= source.end());
-        }
-    }
-
-    return detail::make_string_view_iterator(source, it);
-}
-
 bool is_decimal_digit(char ch) noexcept
 {
     static constexpr std::array<bool, 256> lookup = {
@@ -193,11 +222,533 @@ bool is_decimal_digit(char ch) noexcept
     return lookup[static_cast<size_t>(static_cast<unsigned char>(ch))];
 }
 
-std::string_view::iterator find_nondecimal_digit_simple_impl(
-    std::string_view source)
+struct classic_space_code_unit {
+    static bool matches(char ch) noexcept
+    {
+        return is_ascii_space(ch);
+    }
+};
+struct classic_nonspace_code_unit {
+    static bool matches(char ch) noexcept
+    {
+        return !is_ascii_space(ch);
+    }
+};
+struct nondecimal_digit_code_unit {
+    static bool matches(char ch) noexcept
+    {
+        return !is_decimal_digit(ch);
+    }
+};
+// Only non-ASCII code units
+struct nonascii_code_unit {
+    static bool matches(char) noexcept
+    {
+        return false;
+    }
+};
+
+// The find kernels return the index of the first code unit in
+// [data, data + size) that's either non-ASCII, or matches Pred,
+// or size if there's no such code unit.
+
+template <typename Pred>
+std::size_t find_match_or_nonascii_scalar(const char* data, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i) {
+        if (!is_ascii_char(data[i]) || Pred::matches(data[i])) {
+            return i;
+        }
+    }
+    return size;
+}
+
+#if SCN_HAS_X86_SIMD_KERNELS
+
+namespace sse2 {
+inline __m128i classic_space_mask(__m128i v)
+{
+    // ' ' or '\t'..'\r'
+    const auto off = _mm_sub_epi8(v, _mm_set1_epi8(0x09));
+    return _mm_or_si128(
+        _mm_cmpeq_epi8(v, _mm_set1_epi8(0x20)),
+        _mm_cmpeq_epi8(_mm_min_epu8(off, _mm_set1_epi8(0x04)), off));
+}
+
+inline __m128i match_mask(classic_space_code_unit, __m128i v)
+{
+    return classic_space_mask(v);
+}
+inline __m128i match_mask(classic_nonspace_code_unit, __m128i v)
+{
+    return _mm_xor_si128(classic_space_mask(v), _mm_set1_epi8(-1));
+}
+inline __m128i match_mask(nondecimal_digit_code_unit, __m128i v)
+{
+    const auto off = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+    return _mm_xor_si128(
+        _mm_cmpeq_epi8(_mm_min_epu8(off, _mm_set1_epi8(0x09)), off),
+        _mm_set1_epi8(-1));
+}
+inline __m128i match_mask(nonascii_code_unit, __m128i)
+{
+    return _mm_setzero_si128();
+}
+
+template <typename Pred>
+std::size_t find_match_or_nonascii(const char* data, std::size_t size)
+{
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const auto v =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        // The high bit of every non-ASCII code unit is set
+        const auto mask = static_cast<uint32_t>(
+            _mm_movemask_epi8(_mm_or_si128(match_mask(Pred{}, v), v)));
+        if (mask != 0) {
+            return i + static_cast<std::size_t>(count_trailing_zeroes(mask));
+        }
+    }
+    return i + find_match_or_nonascii_scalar<Pred>(data + i, size - i);
+}
+}  // namespace sse2
+
+SCN_TARGET_AVX2_BEGIN
+
+namespace avx2 {
+inline __m256i classic_space_mask(__m256i v)
+{
+    const auto off = _mm256_sub_epi8(v, _mm256_set1_epi8(0x09));
+    return _mm256_or_si256(
+        _mm256_cmpeq_epi8(v, _mm256_set1_epi8(0x20)),
+        _mm256_cmpeq_epi8(_mm256_min_epu8(off, _mm256_set1_epi8(0x04)), off));
+}
+
+inline __m256i match_mask(classic_space_code_unit, __m256i v)
+{
+    return classic_space_mask(v);
+}
+inline __m256i match_mask(classic_nonspace_code_unit, __m256i v)
+{
+    return _mm256_xor_si256(classic_space_mask(v), _mm256_set1_epi8(-1));
+}
+inline __m256i match_mask(nondecimal_digit_code_unit, __m256i v)
+{
+    const auto off = _mm256_sub_epi8(v, _mm256_set1_epi8('0'));
+    return _mm256_xor_si256(
+        _mm256_cmpeq_epi8(_mm256_min_epu8(off, _mm256_set1_epi8(0x09)), off),
+        _mm256_set1_epi8(-1));
+}
+inline __m256i match_mask(nonascii_code_unit, __m256i)
+{
+    return _mm256_setzero_si256();
+}
+
+template <typename Pred>
+std::size_t find_match_or_nonascii(const char* data, std::size_t size)
+{
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        const auto v =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const auto mask = static_cast<uint32_t>(
+            _mm256_movemask_epi8(_mm256_or_si256(match_mask(Pred{}, v), v)));
+        if (mask != 0) {
+            return i + static_cast<std::size_t>(count_trailing_zeroes(mask));
+        }
+    }
+    return i + find_match_or_nonascii_scalar<Pred>(data + i, size - i);
+}
+}  // namespace avx2
+
+SCN_TARGET_AVX2_END
+
+SCN_TARGET_AVX512BW_BEGIN
+
+namespace avx512bw {
+inline __mmask64 classic_space_mask(__m512i v)
+{
+    const auto off = _mm512_sub_epi8(v, _mm512_set1_epi8(0x09));
+    return _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8(0x20)) |
+           _mm512_cmple_epu8_mask(off, _mm512_set1_epi8(0x04));
+}
+
+inline __mmask64 match_mask(classic_space_code_unit, __m512i v)
+{
+    return classic_space_mask(v);
+}
+inline __mmask64 match_mask(classic_nonspace_code_unit, __m512i v)
+{
+    return ~classic_space_mask(v);
+}
+inline __mmask64 match_mask(nondecimal_digit_code_unit, __m512i v)
+{
+    return ~_mm512_cmple_epu8_mask(_mm512_sub_epi8(v, _mm512_set1_epi8('0')),
+                                   _mm512_set1_epi8(0x09));
+}
+inline __mmask64 match_mask(nonascii_code_unit, __m512i)
+{
+    return 0;
+}
+
+template <typename Pred>
+std::size_t find_match_or_nonascii(const char* data, std::size_t size)
+{
+    std::size_t i = 0;
+    for (; i + 64 <= size; i += 64) {
+        const auto v = _mm512_loadu_si512(data + i);
+        const auto mask = static_cast<uint64_t>(match_mask(Pred{}, v) |
+                                                _mm512_movepi8_mask(v));
+        if (mask != 0) {
+            return i + static_cast<std::size_t>(count_trailing_zeroes(mask));
+        }
+    }
+    return i + find_match_or_nonascii_scalar<Pred>(data + i, size - i);
+}
+}  // namespace avx512bw
+
+SCN_TARGET_AVX512BW_END
+
+#elif SCN_HAS_NEON_KERNELS
+
+namespace neon {
+inline uint8x16_t classic_space_mask(uint8x16_t v)
+{
+    return vorrq_u8(vceqq_u8(v, vdupq_n_u8(0x20)),
+                    vcleq_u8(vsubq_u8(v, vdupq_n_u8(0x09)), vdupq_n_u8(0x04)));
+}
+
+inline uint8x16_t match_mask(classic_space_code_unit, uint8x16_t v)
+{
+    return classic_space_mask(v);
+}
+inline uint8x16_t match_mask(classic_nonspace_code_unit, uint8x16_t v)
+{
+    return vmvnq_u8(classic_space_mask(v));
+}
+inline uint8x16_t match_mask(nondecimal_digit_code_unit, uint8x16_t v)
+{
+    return vmvnq_u8(
+        vcleq_u8(vsubq_u8(v, vdupq_n_u8('0')), vdupq_n_u8(0x09)));
+}
+inline uint8x16_t match_mask(nonascii_code_unit, uint8x16_t)
+{
+    return vdupq_n_u8(0);
+}
+
+template <typename Pred>
+std::size_t find_match_or_nonascii(const char* data, std::size_t size)
+{
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const auto v = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+        const auto matches =
+            vorrq_u8(match_mask(Pred{}, v), vcgeq_u8(v, vdupq_n_u8(0x80)));
+        // Narrow every byte of the mask into four bits
+        const auto mask = vget_lane_u64(
+            vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)),
+            0);
+        if (mask != 0) {
+            return i + static_cast<std::size_t>(count_trailing_zeroes(mask)) / 4;
+        }
+    }
+    return i + find_match_or_nonascii_scalar<Pred>(data + i, size - i);
+}
+}  // namespace neon
+
+#endif
+
+// Skips over ASCII with FindNonascii, and validates the rest
+// one code point at a time, like validate_unicode
+template <std::size_t (*FindNonascii)(const char*, std::size_t)>
+bool validate_utf8_skipping_ascii(const char* data, std::size_t size)
+{
+    std::size_t i = 0;
+    while (true) {
+        i += FindNonascii(data + i, size - i);
+        if (i == size) {
+            return true;
+        }
+
+        const auto len =
+            detail::code_point_length_by_starting_code_unit(data[i]);
+        if (len == 0 || size - i < len) {
+            return false;
+        }
+        const auto cp = detail::decode_code_point_exhaustive(
+            std::string_view{data + i, len});
+        if (cp >= detail::invalid_code_point) {
+            return false;
+        }
+        i += len;
+    }
+}
+
+
+// Lookup-table validation (Keiser & Lemire, "Validating UTF-8 In Less Than
+// One Instruction Per Byte"): every pair of adjacent code units is
+// classified with three 16-entry table lookups, by the high and low nibble
+// of the first one, and the high nibble of the second one. A bit set in all
+// three is an error. Second and third continuation bytes are then checked
+// against the lead bytes two and three positions back.
+//
+// The overlong and surrogate checks of the paper are left out,
+// so that the result matches validate_unicode: overlong encodings and
+// surrogates are accepted, code points above U+10FFFF aren't.
+namespace utf8_lookup {
+// 11______ 0_______, or 11______ 11______
+constexpr uint8_t too_short = 1 << 0;
+// 0_______ 10______
+constexpr uint8_t too_long = 1 << 1;
+// 11110100 1001____, 11110100 101_____,
+// or 11110101..11111111 followed by 1001____ or 101_____
+constexpr uint8_t too_large = 1 << 3;
+// 11110101..11111111 followed by 1000____
+constexpr uint8_t too_large_1000 = 1 << 6;
+// 10______ 10______
+constexpr uint8_t two_conts = 1 << 7;
+// Errors that don't depend on the low nibble of the first code unit
+constexpr uint8_t carry = too_short | too_long | two_conts;
+
+// clang-format off
+constexpr uint8_t byte_1_high[16] = {
+    // 0_______ <ASCII>
+    too_long, too_long, too_long, too_long,
+    too_long, too_long, too_long, too_long,
+    // 10______ <continuation>
+    two_conts, two_conts, two_conts, two_conts,
+    // 110_____, 1110____ <two or three byte lead>
+    too_short, too_short, too_short,
+    // 1111____ <four byte lead>
+    too_short | too_large | too_large_1000};
+constexpr uint8_t byte_1_low[16] = {
+    // ____0000..____0011
+    carry, carry, carry, carry,
+    // ____0100
+    carry | too_large,
+    // ____0101..____1111
+    carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000};
+constexpr uint8_t byte_2_high[16] = {
+    // 0_______ <ASCII>
+    too_short, too_short, too_short, too_short,
+    too_short, too_short, too_short, too_short,
+    // 1000____
+    too_long | two_conts | too_large_1000,
+    // 1001____, 101_____
+    too_long | two_conts | too_large, too_long | two_conts | too_large,
+    too_long | two_conts | too_large,
+    // 11______ <lead>
+    too_short, too_short, too_short, too_short};
+// clang-format on
+}  // namespace utf8_lookup
+
+#if SCN_HAS_X86_SIMD_KERNELS
+
+SCN_TARGET_AVX2_BEGIN
+
+namespace avx2 {
+inline __m256i load_utf8_lookup_table(const uint8_t (&table)[16])
+{
+    return _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+}
+
+struct utf8_validator {
+    // Bytes of block shifted forward by N, the first N coming from the end of
+    // prev_block
+    template <int N>
+    static __m256i prev(__m256i block, __m256i prev_block)
+    {
+        return _mm256_alignr_epi8(
+            block, _mm256_permute2x128_si256(prev_block, block, 0x21), 16 - N);
+    }
+
+    void check_block(__m256i block)
+    {
+        if (_mm256_movemask_epi8(block) == 0) {
+            // An ASCII block can't complete a sequence from the previous one
+            error = _mm256_or_si256(error, prev_incomplete);
+            prev_incomplete = _mm256_setzero_si256();
+            prev_block = block;
+            return;
+        }
+
+        const auto low_nibble_mask = _mm256_set1_epi8(0x0f);
+        const auto prev1 = prev<1>(block, prev_block);
+        const auto special_cases = _mm256_and_si256(
+            _mm256_and_si256(
+                _mm256_shuffle_epi8(
+                    byte_1_high,
+                    _mm256_and_si256(_mm256_srli_epi16(prev1, 4),
+                                     low_nibble_mask)),
+                _mm256_shuffle_epi8(byte_1_low,
+                                    _mm256_and_si256(prev1, low_nibble_mask))),
+            _mm256_shuffle_epi8(
+                byte_2_high, _mm256_and_si256(_mm256_srli_epi16(block, 4),
+                                              low_nibble_mask)));
+
+        // The high bit is set where a third or a fourth code unit
+        // of a sequence is expected: two_conts is an error anywhere else
+        const auto is_third = _mm256_subs_epu8(prev<2>(block, prev_block),
+                                               _mm256_set1_epi8(0xe0 - 0x80));
+        const auto is_fourth =
+            _mm256_subs_epu8(prev<3>(block, prev_block),
+                             _mm256_set1_epi8(static_cast<char>(0xf0 - 0x80)));
+        const auto must_be_continuation =
+            _mm256_and_si256(_mm256_or_si256(is_third, is_fourth),
+                             _mm256_set1_epi8(static_cast<char>(0x80)));
+        error = _mm256_or_si256(
+            error, _mm256_xor_si256(must_be_continuation, special_cases));
+
+        // Lead bytes in the last three positions, that need more code units
+        // than there are left in the block: 1111____ 111_____ 11______
+        const auto incomplete_max = _mm256_setr_epi8(
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            static_cast<char>(0xf0 - 1), static_cast<char>(0xe0 - 1),
+            static_cast<char>(0xc0 - 1));
+        prev_incomplete = _mm256_subs_epu8(block, incomplete_max);
+        prev_block = block;
+    }
+
+    // Spelled out, so that it's compiled for AVX2, too
+    utf8_validator()
+        : byte_1_high(load_utf8_lookup_table(utf8_lookup::byte_1_high)),
+          byte_1_low(load_utf8_lookup_table(utf8_lookup::byte_1_low)),
+          byte_2_high(load_utf8_lookup_table(utf8_lookup::byte_2_high)),
+          error(_mm256_setzero_si256()),
+          prev_block(_mm256_setzero_si256()),
+          prev_incomplete(_mm256_setzero_si256())
+    {
+    }
+
+    const __m256i byte_1_high;
+    const __m256i byte_1_low;
+    const __m256i byte_2_high;
+
+    __m256i error;
+    __m256i prev_block;
+    __m256i prev_incomplete;
+};
+
+bool validate_utf8(const char* data, std::size_t size)
 {
-    return std::find_if(source.begin(), source.end(),
-                        [](char ch) noexcept { return !is_decimal_digit(ch); });
+    utf8_validator validator;
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        validator.check_block(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+    }
+    if (i != size) {
+        // Padding with ASCII doesn't complete a truncated sequence
+        alignas(32) char tail[32]{};
+        std::memcpy(tail, data + i, size - i);
+        validator.check_block(
+            _mm256_load_si256(reinterpret_cast<const __m256i*>(tail)));
+    }
+    const auto error =
+        _mm256_or_si256(validator.error, validator.prev_incomplete);
+    return _mm256_testz_si256(error, error) != 0;
+}
+}  // namespace avx2
+
+SCN_TARGET_AVX2_END
+
+#elif SCN_HAS_NEON_KERNELS
+
+namespace neon {
+struct utf8_validator {
+    template <int N>
+    static uint8x16_t prev(uint8x16_t block, uint8x16_t prev_block)
+    {
+        return vextq_u8(prev_block, block, 16 - N);
+    }
+
+    void check_block(uint8x16_t block)
+    {
+        if (vmaxvq_u8(block) < 0x80) {
+            error = vorrq_u8(error, prev_incomplete);
+            prev_incomplete = vdupq_n_u8(0);
+            prev_block = block;
+            return;
+        }
+
+        const auto prev1 = prev<1>(block, prev_block);
+        const auto special_cases = vandq_u8(
+            vandq_u8(vqtbl1q_u8(byte_1_high, vshrq_n_u8(prev1, 4)),
+                     vqtbl1q_u8(byte_1_low, vandq_u8(prev1, vdupq_n_u8(0x0f)))),
+            vqtbl1q_u8(byte_2_high, vshrq_n_u8(block, 4)));
+
+        const auto is_third =
+            vqsubq_u8(prev<2>(block, prev_block), vdupq_n_u8(0xe0 - 0x80));
+        const auto is_fourth =
+            vqsubq_u8(prev<3>(block, prev_block), vdupq_n_u8(0xf0 - 0x80));
+        const auto must_be_continuation =
+            vandq_u8(vorrq_u8(is_third, is_fourth), vdupq_n_u8(0x80));
+        error = vorrq_u8(error, veorq_u8(must_be_continuation, special_cases));
+
+        static constexpr uint8_t incomplete_max[16] = {
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,     0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xf0 - 1, 0xe0 - 1, 0xc0 - 1};
+        prev_incomplete = vqsubq_u8(block, vld1q_u8(incomplete_max));
+        prev_block = block;
+    }
+
+    const uint8x16_t byte_1_high = vld1q_u8(utf8_lookup::byte_1_high);
+    const uint8x16_t byte_1_low = vld1q_u8(utf8_lookup::byte_1_low);
+    const uint8x16_t byte_2_high = vld1q_u8(utf8_lookup::byte_2_high);
+
+    uint8x16_t error = vdupq_n_u8(0);
+    uint8x16_t prev_block = vdupq_n_u8(0);
+    uint8x16_t prev_incomplete = vdupq_n_u8(0);
+};
+
+bool validate_utf8(const char* data, std::size_t size)
+{
+    utf8_validator validator;
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        validator.check_block(
+            vld1q_u8(reinterpret_cast<const uint8_t*>(data + i)));
+    }
+    if (i != size) {
+        uint8_t tail[16]{};
+        std::memcpy(tail, data + i, size - i);
+        validator.check_block(vld1q_u8(tail));
+    }
+    return vmaxvq_u8(vorrq_u8(validator.error, validator.prev_incomplete)) ==
+           0;
+}
+}  // namespace neon
+
+#endif
+
+template <typename Pred>
+std::string_view::iterator find_classic_impl(std::string_view source,
+                                             std::size_t (*find)(const char*,
+                                                                 std::size_t),
+                                             Pred cp_cb)
+{
+    std::size_t i = 0;
+    while (i < source.size()) {
+        i += find(source.data() + i, source.size() - i);
+        if (i == source.size() || is_ascii_char(source[i])) {
+            break;
+        }
+
+        const auto res = get_next_code_point(source.substr(i));
+        if (cp_cb(res.value)) {
+            break;
+        }
+        i = static_cast<std::size_t>(
+            ranges::distance(source.data(), detail::to_address(res.iterator)));
+    }
+    return source.begin() + static_cast<std::ptrdiff_t>(i);
 }
 }  // namespace
 
@@ -205,7 +756,7 @@ std::string_view::iterator find_classic_space_narrow_fast(
     std::string_view source)
 {
     return find_classic_impl(
-        source, [](char ch) { return is_ascii_space(ch); },
+        source, get_kernel_dispatch_table().find_classic_space_or_nonascii,
         [](char32_t cp) { return detail::is_cp_space(cp); });
 }
 
@@ -213,17 +764,229 @@ std::string_view::iterator find_classic_nonspace_narrow_fast(
     std::string_view source)
 {
     return find_classic_impl(
-        source, [](char ch) { return !is_ascii_space(ch); },
+        source, get_kernel_dispatch_table().find_classic_nonspace_or_nonascii,
         [](char32_t cp) { return !detail::is_cp_space(cp); });
 }
 
 std::string_view::iterator find_nondecimal_digit_narrow_fast(
     std::string_view source)
 {
-    return find_nondecimal_digit_simple_impl(source);
+    // Non-ASCII code units are never decimal digits
+    return source.begin() +
+           static_cast<std::ptrdiff_t>(
+               get_kernel_dispatch_table().find_nondecimal_digit(
+                   source.data(), source.size()));
 }
 }  // namespace impl
 
+/////////////////////////////////////////////////////////////////
+// Transcoding kernels
+/////////////////////////////////////////////////////////////////
+
+namespace impl {
+namespace {
+// The scalar versions convert nothing:
+// transcode_to_string and friends handle everything left over
+std::size_t widen_ascii_scalar(const char*, std::size_t, void*)
+{
+    return 0;
+}
+std::size_t narrow_ascii_from_utf32_scalar(const void*, std::size_t, char*)
+{
+    return 0;
+}
+
+#if SCN_HAS_X86_SIMD_KERNELS
+
+namespace sse2 {
+std::size_t widen_ascii_to_utf16(const char* data,
+                                 std::size_t size,
+                                 void* dest)
+{
+    auto* out = static_cast<__m128i*>(dest);
+    const auto zero = _mm_setzero_si128();
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const auto v =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        if (_mm_movemask_epi8(v) != 0) {
+            break;
+        }
+        _mm_storeu_si128(out++, _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128(out++, _mm_unpackhi_epi8(v, zero));
+    }
+    return i;
+}
+
+std::size_t widen_ascii_to_utf32(const char* data,
+                                 std::size_t size,
+                                 void* dest)
+{
+    auto* out = static_cast<__m128i*>(dest);
+    const auto zero = _mm_setzero_si128();
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const auto v =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        if (_mm_movemask_epi8(v) != 0) {
+            break;
+        }
+        const auto lo = _mm_unpacklo_epi8(v, zero);
+        const auto hi = _mm_unpackhi_epi8(v, zero);
+        _mm_storeu_si128(out++, _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(out++, _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(out++, _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(out++, _mm_unpackhi_epi16(hi, zero));
+    }
+    return i;
+}
+
+std::size_t narrow_ascii_from_utf32(const void* data,
+                                    std::size_t size,
+                                    char* dest)
+{
+    const auto* in = static_cast<const __m128i*>(data);
+    const auto nonascii_bits = _mm_set1_epi32(~0x7f);
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16, in += 4) {
+        const auto a = _mm_loadu_si128(in);
+        const auto b = _mm_loadu_si128(in + 1);
+        const auto c = _mm_loadu_si128(in + 2);
+        const auto d = _mm_loadu_si128(in + 3);
+        const auto all =
+            _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(
+                _mm_and_si128(all, nonascii_bits), _mm_setzero_si128())) !=
+            0xffff) {
+            break;
+        }
+        // Every value is < 0x80, so the saturation never kicks in
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i),
+                         _mm_packus_epi16(_mm_packs_epi32(a, b),
+                                          _mm_packs_epi32(c, d)));
+    }
+    return i;
+}
+}  // namespace sse2
+
+SCN_TARGET_AVX2_BEGIN
+
+namespace avx2 {
+std::size_t widen_ascii_to_utf16(const char* data,
+                                 std::size_t size,
+                                 void* dest)
+{
+    auto* out = static_cast<__m256i*>(dest);
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        const auto v =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        if (_mm256_movemask_epi8(v) != 0) {
+            break;
+        }
+        _mm256_storeu_si256(out++,
+                            _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+        _mm256_storeu_si256(
+            out++, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+    }
+    return i;
+}
+
+std::size_t widen_ascii_to_utf32(const char* data,
+                                 std::size_t size,
+                                 void* dest)
+{
+    auto* out = static_cast<__m256i*>(dest);
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        const auto v =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        if (_mm256_movemask_epi8(v) != 0) {
+            break;
+        }
+        const auto lo = _mm256_castsi256_si128(v);
+        const auto hi = _mm256_extracti128_si256(v, 1);
+        _mm256_storeu_si256(out++, _mm256_cvtepu8_epi32(lo));
+        _mm256_storeu_si256(out++,
+                            _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+        _mm256_storeu_si256(out++, _mm256_cvtepu8_epi32(hi));
+        _mm256_storeu_si256(out++,
+                            _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+    }
+    return i;
+}
+}  // namespace avx2
+
+SCN_TARGET_AVX2_END
+
+#elif SCN_HAS_NEON_KERNELS
+
+namespace neon {
+std::size_t widen_ascii_to_utf16(const char* data,
+                                 std::size_t size,
+                                 void* dest)
+{
+    auto* out = static_cast<uint16_t*>(dest);
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16, out += 16) {
+        const auto v = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+        if (vmaxvq_u8(v) >= 0x80) {
+            break;
+        }
+        vst1q_u16(out, vmovl_u8(vget_low_u8(v)));
+        vst1q_u16(out + 8, vmovl_u8(vget_high_u8(v)));
+    }
+    return i;
+}
+
+std::size_t widen_ascii_to_utf32(const char* data,
+                                 std::size_t size,
+                                 void* dest)
+{
+    auto* out = static_cast<uint32_t*>(dest);
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16, out += 16) {
+        const auto v = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+        if (vmaxvq_u8(v) >= 0x80) {
+            break;
+        }
+        const auto lo = vmovl_u8(vget_low_u8(v));
+        const auto hi = vmovl_u8(vget_high_u8(v));
+        vst1q_u32(out, vmovl_u16(vget_low_u16(lo)));
+        vst1q_u32(out + 4, vmovl_u16(vget_high_u16(lo)));
+        vst1q_u32(out + 8, vmovl_u16(vget_low_u16(hi)));
+        vst1q_u32(out + 12, vmovl_u16(vget_high_u16(hi)));
+    }
+    return i;
+}
+
+std::size_t narrow_ascii_from_utf32(const void* data,
+                                    std::size_t size,
+                                    char* dest)
+{
+    const auto* in = static_cast<const uint32_t*>(data);
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16, in += 16) {
+        const auto a = vld1q_u32(in);
+        const auto b = vld1q_u32(in + 4);
+        const auto c = vld1q_u32(in + 8);
+        const auto d = vld1q_u32(in + 12);
+        if (vmaxvq_u32(vorrq_u32(vorrq_u32(a, b), vorrq_u32(c, d))) >= 0x80) {
+            break;
+        }
+        const auto ab = vcombine_u16(vmovn_u32(a), vmovn_u32(b));
+        const auto cd = vcombine_u16(vmovn_u32(c), vmovn_u32(d));
+        vst1q_u8(reinterpret_cast<uint8_t*>(dest + i),
+                 vcombine_u8(vmovn_u16(ab), vmovn_u16(cd)));
+    }
+    return i;
+}
+}  // namespace neon
+
+#endif
+}  // namespace
+}  // namespace impl
+
 /////////////////////////////////////////////////////////////////
 // Scanner implementations
 /////////////////////////////////////////////////////////////////
@@ -282,6 +1045,26 @@ scan_expected<ranges::iterator_t<Range>> internal_skip_classic_whitespace(
 SCN_DEFINE_SCANNER_SCAN_FOR_CTX(scan_context)
 SCN_DEFINE_SCANNER_SCAN_FOR_CTX(wscan_context)
 
+#if !SCN_DISABLE_REGEX
+template <typename Context>
+scan_expected<typename Context::iterator> scan_regex_matches_into_storage(
+    regex_matches_storage<typename Context::char_type>& storage,
+    Context& ctx,
+    const format_specs& specs)
+{
+    return impl::arg_reader<Context>{ctx.range(), specs, {}}(storage);
+}
+
+template scan_expected<scan_context::iterator> scan_regex_matches_into_storage(
+    regex_matches_storage<char>&,
+    scan_context&,
+    const format_specs&);
+template scan_expected<wscan_context::iterator> scan_regex_matches_into_storage(
+    regex_matches_storage<wchar_t>&,
+    wscan_context&,
+    const format_specs&);
+#endif
+
 /////////////////////////////////////////////////////////////////
 // scan_buffer implementations
 /////////////////////////////////////////////////////////////////
@@ -294,7 +1077,146 @@ template bool basic_scan_file_buffer<stdio_file_interface>::fill();
 template bool basic_scan_file_buffer<stdio_file_interface>::sync(
     std::ptrdiff_t);
 
-}  // namespace detail
+#if SCN_POSIX
+
+std::ptrdiff_t posix_fd_interface::read(char* buf, std::size_t n)
+{
+    while (true) {
+        const auto ret = ::read(fd, buf, n);
+        if (ret == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            error = errno;
+        }
+        return static_cast<std::ptrdiff_t>(ret);
+    }
+}
+
+template basic_scan_fd_buffer<posix_fd_interface>::basic_scan_fd_buffer(
+    posix_fd_interface,
+    std::size_t);
+template bool basic_scan_fd_buffer<posix_fd_interface>::fill();
+
+#endif  // SCN_POSIX
+
+}  // namespace detail
+
+/////////////////////////////////////////////////////////////////
+// mapped_file implementation
+/////////////////////////////////////////////////////////////////
+
+#if SCN_POSIX
+
+mapped_file::mapped_file(const char* filename)
+{
+    const int fd = ::open(filename, O_RDONLY);
+    if (fd == -1) {
+        return;
+    }
+
+    struct ::stat st {};
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        return;
+    }
+
+    if (st.st_size == 0) {
+        // mmap doesn't allow zero-sized mappings
+        ::close(fd);
+        m_valid = true;
+        return;
+    }
+
+    const auto size = static_cast<std::size_t>(st.st_size);
+    void* ptr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping stays alive after the descriptor is closed
+    ::close(fd);
+    if (ptr == MAP_FAILED) {
+        return;
+    }
+#ifdef MADV_SEQUENTIAL
+    (void)::madvise(ptr, size, MADV_SEQUENTIAL);
+#endif
+
+    m_data = static_cast<const char*>(ptr);
+    m_size = size;
+    m_valid = true;
+}
+
+void mapped_file::unmap() noexcept
+{
+    if (m_data) {
+        ::munmap(const_cast<char*>(m_data), m_size);
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_valid = false;
+}
+
+#elif SCN_WINDOWS
+
+mapped_file::mapped_file(const char* filename)
+{
+    HANDLE file =
+        ::CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                      OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+
+    LARGE_INTEGER size{};
+    if (!::GetFileSizeEx(file, &size)) {
+        ::CloseHandle(file);
+        return;
+    }
+
+    if (size.QuadPart == 0) {
+        // CreateFileMapping doesn't allow zero-sized mappings
+        ::CloseHandle(file);
+        m_valid = true;
+        return;
+    }
+
+    HANDLE mapping =
+        ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    ::CloseHandle(file);
+    if (!mapping) {
+        return;
+    }
+
+    // The view stays alive after the mapping handle is closed
+    const void* ptr = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    ::CloseHandle(mapping);
+    if (!ptr) {
+        return;
+    }
+
+    m_data = static_cast<const char*>(ptr);
+    m_size = static_cast<std::size_t>(size.QuadPart);
+    m_valid = true;
+}
+
+void mapped_file::unmap() noexcept
+{
+    if (m_data) {
+        ::UnmapViewOfFile(m_data);
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_valid = false;
+}
+
+#else
+
+mapped_file::mapped_file(const char* filename)
+{
+    SCN_UNUSED(filename);
+}
+
+void mapped_file::unmap() noexcept {}
+
+#endif
 
 /////////////////////////////////////////////////////////////////
 // locale implementations
@@ -885,6 +1807,23 @@ struct impl_init_data {
 ////////////////////////////////////////////////////////////////////
 
 #if !SCN_DISABLE_STRTOD
+#if SCN_XLOCALE == SCN_XLOCALE_POSIX
+// Created once, and shared by every call to strtod_l & co.,
+// so that the global C locale is never touched.
+// Null, if creating it failed.
+locale_t get_classic_xlocale()
+{
+    static const locale_t loc = ::newlocale(LC_ALL_MASK, "C", locale_t{});
+    return loc;
+}
+#elif SCN_XLOCALE == SCN_XLOCALE_MSVC
+_locale_t get_classic_xlocale()
+{
+    static const _locale_t loc = ::_create_locale(LC_ALL, "C");
+    return loc;
+}
+#endif
+
 template <typename T>
 struct strtod_impl_base {
     template <typename CharT, typename Strtod>
@@ -995,29 +1934,32 @@ struct strtod_impl_base {
         }
 #endif
 
+#if SCN_XLOCALE != SCN_XLOCALE_OTHER
+        if (const auto cloc = get_classic_xlocale(); SCN_LIKELY(cloc)) {
 #if SCN_XLOCALE == SCN_XLOCALE_POSIX
-        static locale_t cloc = ::newlocale(LC_ALL_MASK, "C", NULL);
-        if constexpr (std::is_same_v<T, float>) {
-            return ::strtof_l(str, str_end, cloc);
-        }
-        else if constexpr (std::is_same_v<T, double>) {
-            return ::strtod_l(str, str_end, cloc);
-        }
-        else if constexpr (std::is_same_v<T, long double>) {
-            return ::strtold_l(str, str_end, cloc);
-        }
-#elif SCN_XLOCALE == SCN_XLOCALE_MSVC
-        static _locale_t cloc = ::_create_locale(LC_ALL, "C");
-        if constexpr (std::is_same_v<T, float>) {
-            return ::_strtof_l(str, str_end, cloc);
-        }
-        else if constexpr (std::is_same_v<T, double>) {
-            return ::_strtod_l(str, str_end, cloc);
-        }
-        else if constexpr (std::is_same_v<T, long double>) {
-            return ::_strtold_l(str, str_end, cloc);
-        }
+            if constexpr (std::is_same_v<T, float>) {
+                return ::strtof_l(str, str_end, cloc);
+            }
+            else if constexpr (std::is_same_v<T, double>) {
+                return ::strtod_l(str, str_end, cloc);
+            }
+            else if constexpr (std::is_same_v<T, long double>) {
+                return ::strtold_l(str, str_end, cloc);
+            }
 #else
+            if constexpr (std::is_same_v<T, float>) {
+                return ::_strtof_l(str, str_end, cloc);
+            }
+            else if constexpr (std::is_same_v<T, double>) {
+                return ::_strtod_l(str, str_end, cloc);
+            }
+            else if constexpr (std::is_same_v<T, long double>) {
+                return ::_strtold_l(str, str_end, cloc);
+            }
+#endif
+        }
+#endif
+
         set_clocale_classic_guard clocale_guard{LC_NUMERIC};
         if constexpr (std::is_same_v<T, float>) {
             return std::strtof(str, str_end);
@@ -1028,7 +1970,6 @@ struct strtod_impl_base {
         else if constexpr (std::is_same_v<T, long double>) {
             return std::strtold(str, str_end);
         }
-#endif
 
         SCN_EXPECT(false);
         SCN_UNREACHABLE;
@@ -1043,29 +1984,32 @@ struct strtod_impl_base {
         }
 #endif
 
+#if SCN_XLOCALE != SCN_XLOCALE_OTHER
+        if (const auto cloc = get_classic_xlocale(); SCN_LIKELY(cloc)) {
 #if SCN_XLOCALE == SCN_XLOCALE_POSIX
-        static locale_t cloc = ::newlocale(LC_ALL_MASK, "C", NULL);
-        if constexpr (std::is_same_v<T, float>) {
-            return ::wcstof_l(str, str_end, cloc);
-        }
-        else if constexpr (std::is_same_v<T, double>) {
-            return ::wcstod_l(str, str_end, cloc);
-        }
-        else if constexpr (std::is_same_v<T, long double>) {
-            return ::wcstold_l(str, str_end, cloc);
-        }
-#elif SCN_XLOCALE == SCN_XLOCALE_MSVC
-        static _locale_t cloc = ::_create_locale(LC_ALL, "C");
-        if constexpr (std::is_same_v<T, float>) {
-            return ::_wcstof_l(str, str_end, cloc);
-        }
-        else if constexpr (std::is_same_v<T, double>) {
-            return ::_wcstod_l(str, str_end, cloc);
-        }
-        else if constexpr (std::is_same_v<T, long double>) {
-            return ::_wcstold_l(str, str_end, cloc);
-        }
+            if constexpr (std::is_same_v<T, float>) {
+                return ::wcstof_l(str, str_end, cloc);
+            }
+            else if constexpr (std::is_same_v<T, double>) {
+                return ::wcstod_l(str, str_end, cloc);
+            }
+            else if constexpr (std::is_same_v<T, long double>) {
+                return ::wcstold_l(str, str_end, cloc);
+            }
 #else
+            if constexpr (std::is_same_v<T, float>) {
+                return ::_wcstof_l(str, str_end, cloc);
+            }
+            else if constexpr (std::is_same_v<T, double>) {
+                return ::_wcstod_l(str, str_end, cloc);
+            }
+            else if constexpr (std::is_same_v<T, long double>) {
+                return ::_wcstold_l(str, str_end, cloc);
+            }
+#endif
+        }
+#endif
+
         set_clocale_classic_guard clocale_guard{LC_NUMERIC};
         if constexpr (std::is_same_v<T, float>) {
             return std::wcstof(str, str_end);
@@ -1076,7 +2020,6 @@ struct strtod_impl_base {
         else if constexpr (std::is_same_v<T, long double>) {
             return std::wcstold(str, str_end);
         }
-#endif
 
         SCN_EXPECT(false);
         SCN_UNREACHABLE;
@@ -1978,6 +2921,61 @@ const char* parse_decimal_integer_fast_impl(const char* begin,
     return begin;
 }
 
+#if SCN_HAS_X86_SIMD_KERNELS
+
+SCN_TARGET_AVX2_BEGIN
+
+namespace avx2 {
+// Converts 16 decimal digits (as values 0-9) into an integer
+uint64_t convert_sixteen_decimal_digits(__m128i digits)
+{
+    // 8 x 2 digits, 4 x 4 digits, 2 x 8 digits
+    const auto pairs = _mm_maddubs_epi16(
+        digits, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1,
+                              10, 1));
+    const auto quads = _mm_madd_epi16(
+        pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+    const auto quads16 = _mm_packus_epi32(quads, quads);
+    const auto octets = _mm_madd_epi16(
+        quads16, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+
+    const auto hi = static_cast<uint32_t>(_mm_cvtsi128_si32(octets));
+    const auto lo = static_cast<uint32_t>(_mm_extract_epi32(octets, 1));
+    return uint64_t{hi} * 100'000'000 + lo;
+}
+
+// Same as parse_decimal_integer_fast_impl,
+// but validates and converts 16 digits at a time
+const char* parse_decimal_digits(const char* begin,
+                                 const char* const end,
+                                 uint64_t& val)
+{
+    while (end - begin >= 16) {
+        const auto digits =
+            _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(begin)),
+                         _mm_set1_epi8('0'));
+        const auto is_digit = _mm_cmpeq_epi8(
+            _mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+        const auto nondigits =
+            ~static_cast<uint32_t>(_mm_movemask_epi8(is_digit)) & 0xffffu;
+        if (nondigits != 0) {
+            // The length of the rest of the digit run is now known
+            const auto n = count_trailing_zeroes(nondigits);
+            return parse_decimal_integer_fast_impl(begin, begin + n, val);
+        }
+
+        val = val * 10'000'000'000'000'000 +
+              convert_sixteen_decimal_digits(digits);
+        begin += 16;
+    }
+    return parse_decimal_integer_fast_impl(begin, end, val);
+}
+}  // namespace avx2
+
+SCN_TARGET_AVX2_END
+
+#endif  // SCN_HAS_X86_SIMD_KERNELS
+
 constexpr size_t maxdigits_u64_table[] = {
     0,  0,  64, 41, 32, 28, 25, 23, 22, 21, 20, 19, 18, 18, 17, 17, 16, 16, 16,
     16, 15, 15, 15, 15, 14, 14, 14, 14, 14, 14, 14, 13, 13, 13, 13, 13, 13};
@@ -2081,8 +3079,12 @@ auto parse_decimal_integer_fast(std::string_view input,
     static_assert(sizeof(T) <= sizeof(std::uint64_t));
 
     uint64_t u64val{};
-    auto ptr = parse_decimal_integer_fast_impl(
-        input.data(), input.data() + input.size(), u64val);
+    // Short inputs aren't worth an indirect call
+    auto ptr = input.size() < 16
+                   ? parse_decimal_integer_fast_impl(
+                         input.data(), input.data() + input.size(), u64val)
+                   : get_kernel_dispatch_table().parse_decimal_digits(
+                         input.data(), input.data() + input.size(), u64val);
 
     auto digits_count = static_cast<size_t>(ptr - input.data());
     if (SCN_UNLIKELY(
@@ -2163,6 +3165,38 @@ auto parse_int128(std::basic_string_view<CharT> input,
     const CharT* const end = input.data() + input.size();
     uint128 acc{};
 
+    if constexpr (std::is_same_v<CharT, char>) {
+        // Long decimal runs are converted up to 16 digits at a time
+        if (base == 10 && end - begin >= 16) {
+            const uint128 max_val = limit_val * 10 + max_digit;
+            const auto parse_digits =
+                get_kernel_dispatch_table().parse_decimal_digits;
+
+            while (end - begin >= 16) {
+                uint64_t chunk{};
+                const auto chunk_end = parse_digits(begin, begin + 16, chunk);
+                uint64_t multiplier = 1;
+                for (auto it = begin; it != chunk_end; ++it) {
+                    multiplier *= 10;
+                }
+
+                if (SCN_UNLIKELY(acc > (max_val - chunk) / multiplier)) {
+                    return detail::unexpected_scan_error(
+                        is_negative ? scan_error::value_negative_overflow
+                                    : scan_error::value_positive_overflow,
+                        "Integer overflow");
+                }
+                acc = acc * multiplier + chunk;
+
+                const bool chunk_was_full = chunk_end - begin == 16;
+                begin = chunk_end;
+                if (!chunk_was_full) {
+                    break;
+                }
+            }
+        }
+    }
+
     while (begin != end) {
         const auto digit = char_to_int(*begin);
         if (SCN_UNLIKELY(digit >= base)) {
@@ -2386,6 +3420,491 @@ SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, uint128)
 #undef SCN_DEFINE_INTEGER_READER_TEMPLATE
 }  // namespace impl
 
+/////////////////////////////////////////////////////////////////
+// Kernel dispatch
+/////////////////////////////////////////////////////////////////
+
+namespace impl {
+namespace {
+#if SCN_HAS_X86_SIMD_KERNELS
+
+#if SCN_GCC_COMPAT
+bool cpu_supports_avx2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+bool cpu_supports_avx512bw()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx512f") &&
+           __builtin_cpu_supports("avx512bw");
+}
+#else
+// Whether the OS saves the register state enabled in xcr0_mask
+bool os_supports_xsave_state(unsigned long long xcr0_mask)
+{
+    int info[4]{};
+    __cpuid(info, 1);
+    // OSXSAVE
+    if ((info[2] & (1 << 27)) == 0) {
+        return false;
+    }
+    return (_xgetbv(0) & xcr0_mask) == xcr0_mask;
+}
+bool cpuid_leaf7_ebx_has(int bits)
+{
+    int info[4]{};
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & bits) == bits;
+}
+
+bool cpu_supports_avx2()
+{
+    // XMM and YMM state
+    return os_supports_xsave_state(0x6) && cpuid_leaf7_ebx_has(1 << 5);
+}
+bool cpu_supports_avx512bw()
+{
+    // XMM, YMM, opmask, and ZMM state; AVX512F and AVX512BW
+    return os_supports_xsave_state(0xe6) &&
+           cpuid_leaf7_ebx_has((1 << 16) | (1 << 30));
+}
+#endif
+
+#endif  // SCN_HAS_X86_SIMD_KERNELS
+
+template <template <typename> class FindKernel, typename TranscodeKernels>
+constexpr kernel_dispatch_table make_kernel_dispatch_table(
+    kernel_isa isa,
+    const char* (*parse_decimal_digits)(const char*, const char*, uint64_t&),
+    bool (*validate_utf8)(const char*, std::size_t) =
+        validate_utf8_skipping_ascii<FindKernel<nonascii_code_unit>::value>)
+{
+    return {isa,
+            FindKernel<classic_space_code_unit>::value,
+            FindKernel<classic_nonspace_code_unit>::value,
+            FindKernel<nondecimal_digit_code_unit>::value,
+            FindKernel<nonascii_code_unit>::value,
+            parse_decimal_digits,
+            validate_utf8,
+            TranscodeKernels::widen_ascii_to_utf16,
+            TranscodeKernels::widen_ascii_to_utf32,
+            TranscodeKernels::narrow_ascii_from_utf32};
+}
+
+template <typename Pred>
+struct scalar_find_kernel {
+    static constexpr auto value = find_match_or_nonascii_scalar<Pred>;
+};
+
+struct scalar_transcode_kernels {
+    static constexpr auto widen_ascii_to_utf16 = widen_ascii_scalar;
+    static constexpr auto widen_ascii_to_utf32 = widen_ascii_scalar;
+    static constexpr auto narrow_ascii_from_utf32 =
+        narrow_ascii_from_utf32_scalar;
+};
+
+#if SCN_HAS_X86_SIMD_KERNELS
+struct sse2_transcode_kernels {
+    static constexpr auto widen_ascii_to_utf16 = sse2::widen_ascii_to_utf16;
+    static constexpr auto widen_ascii_to_utf32 = sse2::widen_ascii_to_utf32;
+    static constexpr auto narrow_ascii_from_utf32 =
+        sse2::narrow_ascii_from_utf32;
+};
+// 256-bit packs work within 128-bit lanes, and would need an extra permute:
+// narrowing uses the SSE2 kernel
+struct avx2_transcode_kernels {
+    static constexpr auto widen_ascii_to_utf16 = avx2::widen_ascii_to_utf16;
+    static constexpr auto widen_ascii_to_utf32 = avx2::widen_ascii_to_utf32;
+    static constexpr auto narrow_ascii_from_utf32 =
+        sse2::narrow_ascii_from_utf32;
+};
+#elif SCN_HAS_NEON_KERNELS
+struct neon_transcode_kernels {
+    static constexpr auto widen_ascii_to_utf16 = neon::widen_ascii_to_utf16;
+    static constexpr auto widen_ascii_to_utf32 = neon::widen_ascii_to_utf32;
+    static constexpr auto narrow_ascii_from_utf32 =
+        neon::narrow_ascii_from_utf32;
+};
+#endif
+
+#if SCN_HAS_X86_SIMD_KERNELS
+template <typename Pred>
+struct sse2_find_kernel {
+    static constexpr auto value = sse2::find_match_or_nonascii<Pred>;
+};
+template <typename Pred>
+struct avx2_find_kernel {
+    static constexpr auto value = avx2::find_match_or_nonascii<Pred>;
+};
+template <typename Pred>
+struct avx512bw_find_kernel {
+    static constexpr auto value = avx512bw::find_match_or_nonascii<Pred>;
+};
+#elif SCN_HAS_NEON_KERNELS
+template <typename Pred>
+struct neon_find_kernel {
+    static constexpr auto value = neon::find_match_or_nonascii<Pred>;
+};
+#endif
+
+constexpr kernel_dispatch_table scalar_kernel_dispatch_table =
+    make_kernel_dispatch_table<scalar_find_kernel, scalar_transcode_kernels>(
+        kernel_isa::scalar, parse_decimal_integer_fast_impl);
+#if SCN_HAS_X86_SIMD_KERNELS
+// The 16-digit conversion and the lookup-table UTF-8 validation need
+// SSSE3 and SSE4.1, so they're only used with AVX2 and up
+constexpr kernel_dispatch_table sse2_kernel_dispatch_table =
+    make_kernel_dispatch_table<sse2_find_kernel, sse2_transcode_kernels>(
+        kernel_isa::sse2, parse_decimal_integer_fast_impl);
+constexpr kernel_dispatch_table avx2_kernel_dispatch_table =
+    make_kernel_dispatch_table<avx2_find_kernel, avx2_transcode_kernels>(
+        kernel_isa::avx2, avx2::parse_decimal_digits, avx2::validate_utf8);
+constexpr kernel_dispatch_table avx512bw_kernel_dispatch_table =
+    make_kernel_dispatch_table<avx512bw_find_kernel, avx2_transcode_kernels>(
+        kernel_isa::avx512bw, avx2::parse_decimal_digits, avx2::validate_utf8);
+#elif SCN_HAS_NEON_KERNELS
+constexpr kernel_dispatch_table neon_kernel_dispatch_table =
+    make_kernel_dispatch_table<neon_find_kernel, neon_transcode_kernels>(
+        kernel_isa::neon, parse_decimal_integer_fast_impl, neon::validate_utf8);
+#endif
+
+kernel_isa detect_kernel_isa()
+{
+#if SCN_HAS_X86_SIMD_KERNELS
+    if (cpu_supports_avx512bw()) {
+        return kernel_isa::avx512bw;
+    }
+    if (cpu_supports_avx2()) {
+        return kernel_isa::avx2;
+    }
+    return kernel_isa::sse2;
+#elif SCN_HAS_NEON_KERNELS
+    return kernel_isa::neon;
+#else
+    return kernel_isa::scalar;
+#endif
+}
+}  // namespace
+
+bool is_kernel_isa_supported(kernel_isa isa)
+{
+#if SCN_HAS_X86_SIMD_KERNELS
+    if (isa == kernel_isa::avx2) {
+        return cpu_supports_avx2();
+    }
+    if (isa == kernel_isa::avx512bw) {
+        return cpu_supports_avx512bw();
+    }
+    return isa == kernel_isa::scalar || isa == kernel_isa::sse2;
+#elif SCN_HAS_NEON_KERNELS
+    return isa == kernel_isa::scalar || isa == kernel_isa::neon;
+#else
+    return isa == kernel_isa::scalar;
+#endif
+}
+
+const kernel_dispatch_table& get_kernel_dispatch_table(kernel_isa isa)
+{
+    SCN_EXPECT(is_kernel_isa_supported(isa));
+#if SCN_HAS_X86_SIMD_KERNELS
+    if (isa == kernel_isa::sse2) {
+        return sse2_kernel_dispatch_table;
+    }
+    if (isa == kernel_isa::avx2) {
+        return avx2_kernel_dispatch_table;
+    }
+    if (isa == kernel_isa::avx512bw) {
+        return avx512bw_kernel_dispatch_table;
+    }
+#elif SCN_HAS_NEON_KERNELS
+    if (isa == kernel_isa::neon) {
+        return neon_kernel_dispatch_table;
+    }
+#endif
+    return scalar_kernel_dispatch_table;
+}
+
+const kernel_dispatch_table& get_kernel_dispatch_table()
+{
+    static const kernel_dispatch_table& table =
+        get_kernel_dispatch_table(detect_kernel_isa());
+    return table;
+}
+}  // namespace impl
+
+/////////////////////////////////////////////////////////////////
+// Regex cache
+/////////////////////////////////////////////////////////////////
+
+#if !SCN_DISABLE_REGEX
+regex_cache_stats get_regex_cache_stats()
+{
+    return impl::regex_cache_thread_stats();
+}
+#endif
+
+/////////////////////////////////////////////////////////////////
+// Parallel scanning
+/////////////////////////////////////////////////////////////////
+
+namespace detail {
+std::size_t parallel_scan_thread_count(std::size_t requested)
+{
+    if (requested != 0) {
+        return requested;
+    }
+    return (std::max)(std::size_t{std::thread::hardware_concurrency()},
+                      std::size_t{1});
+}
+
+std::size_t parallel_scan_chunk_count(std::size_t size,
+                                      std::size_t thread_count)
+{
+    // Enough chunks per thread for work stealing to even out differences
+    // in their scanning times, but not so small that handing them out
+    // dominates
+    constexpr std::size_t chunks_per_thread = 16;
+    constexpr std::size_t min_chunk_size = 16 * 1024;
+    return (std::max)(std::size_t{1}, (std::min)(size / min_chunk_size,
+                                                 thread_count * chunks_per_thread));
+}
+
+void split_at_delimiters(std::string_view buffer,
+                         char delimiter,
+                         std::string_view* chunks,
+                         std::size_t chunk_count)
+{
+    SCN_EXPECT(chunk_count > 0);
+    std::size_t chunk_begin = 0;
+    for (std::size_t i = 0; i < chunk_count - 1; ++i) {
+        const auto target = (std::max)(
+            chunk_begin, buffer.size() / chunk_count * (i + 1));
+        auto chunk_end = buffer.size();
+        if (target < buffer.size()) {
+            if (const auto* delim = static_cast<const char*>(
+                    std::memchr(buffer.data() + target, delimiter,
+                                buffer.size() - target))) {
+                chunk_end = static_cast<std::size_t>(delim - buffer.data()) + 1;
+            }
+        }
+        chunks[i] = buffer.substr(chunk_begin, chunk_end - chunk_begin);
+        chunk_begin = chunk_end;
+    }
+    chunks[chunk_count - 1] = buffer.substr(chunk_begin);
+}
+
+void run_parallel_scan(const parallel_scan_chunk_jobs& jobs,
+                       std::size_t thread_count)
+{
+    if (thread_count <= 1 || jobs.chunk_count <= 1) {
+        for (std::size_t i = 0; i < jobs.chunk_count; ++i) {
+            jobs.scan_chunk(jobs.context, i);
+            jobs.deliver_chunk(jobs.context, i);
+        }
+        return;
+    }
+
+    scan_executor executor{(std::min)(thread_count, jobs.chunk_count)};
+    run_parallel_scan(jobs, executor);
+}
+}  // namespace detail
+
+struct scan_executor::impl {
+    // The chunks [begin, end) still to be scanned by a worker.
+    // A worker takes chunks from the front of its own queue, and when
+    // that's empty, steals the back half of the queue of another worker.
+    struct worker_queue {
+        std::mutex mutex{};
+        std::size_t begin{0};
+        std::size_t end{0};
+    };
+
+    explicit impl(std::size_t thread_count) : queues(thread_count)
+    {
+        threads.reserve(thread_count);
+        for (std::size_t i = 0; i < thread_count; ++i) {
+            threads.emplace_back([this, i]() { work(i); });
+        }
+    }
+
+    ~impl()
+    {
+        {
+            std::lock_guard lock{mutex};
+            shutting_down = true;
+        }
+        job_available.notify_all();
+        for (auto& t : threads) {
+            t.join();
+        }
+    }
+
+    impl(const impl&) = delete;
+    impl(impl&&) = delete;
+    impl& operator=(const impl&) = delete;
+    impl& operator=(impl&&) = delete;
+
+    void run(const detail::parallel_scan_chunk_jobs& jobs)
+    {
+        std::lock_guard run_lock{run_mutex};
+
+        {
+            std::lock_guard lock{mutex};
+            const auto n = queues.size();
+            for (std::size_t w = 0; w < n; ++w) {
+                std::lock_guard queue_lock{queues[w].mutex};
+                queues[w].begin = jobs.chunk_count * w / n;
+                queues[w].end = jobs.chunk_count * (w + 1) / n;
+            }
+            done.assign(jobs.chunk_count, false);
+            job = &jobs;
+            cancelled.store(false);
+            workers_finished = 0;
+            ++job_generation;
+        }
+        job_available.notify_all();
+
+        // Waits for the workers to be done with `jobs`,
+        // also if `deliver_chunk` throws
+        struct job_guard {
+            ~job_guard()
+            {
+                self.cancelled.store(true);
+                std::unique_lock lock{self.mutex};
+                self.chunk_done.wait(lock, [&]() {
+                    return self.workers_finished == self.threads.size();
+                });
+                self.job = nullptr;
+            }
+
+            impl& self;
+        } guard{*this};
+
+        for (std::size_t i = 0; i < jobs.chunk_count; ++i) {
+            {
+                std::unique_lock lock{mutex};
+                chunk_done.wait(lock, [&]() { return done[i]; });
+            }
+            jobs.deliver_chunk(jobs.context, i);
+        }
+    }
+
+private:
+    void work(std::size_t self)
+    {
+        std::uint64_t seen_generation = 0;
+        while (true) {
+            const detail::parallel_scan_chunk_jobs* current_job{};
+            {
+                std::unique_lock lock{mutex};
+                job_available.wait(lock, [&]() {
+                    return shutting_down || job_generation != seen_generation;
+                });
+                if (shutting_down) {
+                    return;
+                }
+                seen_generation = job_generation;
+                current_job = job;
+            }
+
+            std::size_t chunk{};
+            while (!cancelled.load(std::memory_order_relaxed) &&
+                   take_chunk(self, chunk)) {
+                current_job->scan_chunk(current_job->context, chunk);
+                {
+                    std::lock_guard lock{mutex};
+                    done[chunk] = true;
+                }
+                chunk_done.notify_all();
+            }
+
+            {
+                std::lock_guard lock{mutex};
+                ++workers_finished;
+            }
+            chunk_done.notify_all();
+        }
+    }
+
+    bool take_chunk(std::size_t self, std::size_t& chunk)
+    {
+        auto& own = queues[self];
+        {
+            std::lock_guard lock{own.mutex};
+            if (own.begin != own.end) {
+                chunk = own.begin++;
+                return true;
+            }
+        }
+
+        for (std::size_t i = 1; i < queues.size(); ++i) {
+            auto& victim = queues[(self + i) % queues.size()];
+            std::size_t stolen_begin{}, stolen_end{};
+            {
+                std::lock_guard lock{victim.mutex};
+                const auto available = victim.end - victim.begin;
+                if (available == 0) {
+                    continue;
+                }
+                stolen_end = victim.end;
+                stolen_begin = victim.end - (available + 1) / 2;
+                victim.end = stolen_begin;
+            }
+
+            chunk = stolen_begin;
+            std::lock_guard lock{own.mutex};
+            own.begin = stolen_begin + 1;
+            own.end = stolen_end;
+            return true;
+        }
+        return false;
+    }
+
+public:
+    std::vector<std::thread> threads{};
+    std::vector<worker_queue> queues;
+
+    // Serializes calls to `run()`
+    std::mutex run_mutex{};
+
+    // Guards everything below
+    std::mutex mutex{};
+    std::condition_variable job_available{};
+    std::condition_variable chunk_done{};
+    const detail::parallel_scan_chunk_jobs* job{nullptr};
+    std::uint64_t job_generation{0};
+    std::vector<bool> done{};
+    std::size_t workers_finished{0};
+    bool shutting_down{false};
+
+    std::atomic<bool> cancelled{false};
+};
+
+scan_executor::scan_executor(std::size_t thread_count)
+    : m_impl(std::make_unique<impl>(
+          detail::parallel_scan_thread_count(thread_count)))
+{
+}
+
+scan_executor::~scan_executor() = default;
+
+std::size_t scan_executor::thread_count() const
+{
+    return m_impl->threads.size();
+}
+
+void detail::run_parallel_scan(const parallel_scan_chunk_jobs& jobs,
+                               scan_executor& executor)
+{
+    executor.m_impl->run(jobs);
+}
+
 /////////////////////////////////////////////////////////////////
 // vscan implementation
 /////////////////////////////////////////////////////////////////
@@ -2754,6 +4273,19 @@ struct format_handler : format_handler_base {
             arg);
     }
 
+    // Specs parsed at compile time, see compiled_format
+    void on_compiled_format_specs(std::size_t arg_id,
+                                  const detail::format_specs& specs)
+    {
+        auto arg = get_arg(get_ctx(), arg_id, *this);
+        set_arg_as_visited(arg_id);
+
+        on_visit_scan_arg(impl::arg_reader<context_type>{get_ctx().range(),
+                                                         specs,
+                                                         get_ctx().locale()},
+                          arg);
+    }
+
     const char_type* on_format_specs(std::size_t arg_id,
                                      const char_type* begin,
                                      const char_type* end)
@@ -2868,6 +4400,91 @@ scan_expected<std::ptrdiff_t> vscan_internal(
     }
 }
 
+template <typename CharT, typename Handler>
+scan_expected<std::ptrdiff_t> vscan_run_compiled_format(
+    detail::compiled_format_view<CharT> format,
+    Handler& handler)
+{
+    using kind_type = typename detail::compiled_format_op<CharT>::kind_type;
+
+    const auto beg = handler.get_ctx().begin();
+    for (auto op = format.ops; op != format.ops + format.size; ++op) {
+        if (op->kind == kind_type::literal) {
+            handler.on_literal_text(op->text.data(),
+                                    op->text.data() + op->text.size());
+        }
+        else if (op->kind == kind_type::default_field) {
+            handler.on_replacement_field(op->arg_id, nullptr);
+        }
+        else if (op->kind == kind_type::specs_field) {
+            handler.on_compiled_format_specs(op->arg_id, op->specs);
+        }
+        else {
+            handler.on_format_specs(op->arg_id, op->text.data(),
+                                    format.str.data() + format.str.size());
+        }
+
+        if (auto err = handler.get_error(); SCN_UNLIKELY(!err)) {
+            return unexpected(err.error());
+        }
+    }
+    return ranges::distance(beg, handler.get_ctx().begin());
+}
+
+template <typename CharT>
+bool is_simple_single_argument_compiled_format(
+    detail::compiled_format_view<CharT> format)
+{
+    return format.size == 1 &&
+           format.ops[0].kind ==
+               detail::compiled_format_op<CharT>::kind_type::default_field;
+}
+
+template <typename CharT>
+scan_expected<std::ptrdiff_t> vscan_compiled_internal(
+    std::basic_string_view<CharT> source,
+    detail::compiled_format_view<CharT> format,
+    basic_scan_args<detail::default_context<CharT>> args)
+{
+    const auto argcount = args.size();
+    if (is_simple_single_argument_compiled_format(format) && argcount == 1) {
+        auto arg = args.get(0);
+        return scan_simple_single_argument(source, SCN_MOVE(args), arg);
+    }
+
+    auto handler = format_handler<true, CharT>{
+        ranges::subrange<const CharT*>{source.data(),
+                                       source.data() + source.size()},
+        format.str, SCN_MOVE(args), {}, argcount};
+    return vscan_run_compiled_format(format, handler);
+}
+
+template <typename CharT>
+scan_expected<std::ptrdiff_t> vscan_compiled_internal(
+    detail::basic_scan_buffer<CharT>& buffer,
+    detail::compiled_format_view<CharT> format,
+    basic_scan_args<detail::default_context<CharT>> args)
+{
+    const auto argcount = args.size();
+    if (is_simple_single_argument_compiled_format(format) && argcount == 1) {
+        auto arg = args.get(0);
+        return scan_simple_single_argument(buffer, SCN_MOVE(args), arg);
+    }
+
+    if (buffer.is_contiguous()) {
+        auto handler = format_handler<true, CharT>{
+            buffer.get_contiguous(), format.str, SCN_MOVE(args), {}, argcount};
+        return vscan_run_compiled_format(format, handler);
+    }
+
+    SCN_UNLIKELY_ATTR
+    {
+        auto handler = format_handler<false, CharT>{
+            buffer, format.str, SCN_MOVE(args), {}, argcount};
+        return vscan_run_compiled_format(format, handler);
+    }
+}
+
 template <typename Source, typename CharT>
 scan_expected<std::ptrdiff_t> vscan_value_internal(
     Source&& source,
@@ -2896,11 +4513,206 @@ auto scan_int_exhaustive_valid_impl(std::string_view source) -> T
     impl::parse_integer_value_exhaustive_valid(source, value);
     return value;
 }
+
+namespace {
+// Only takes the Unicode-aware path when a non-ASCII code unit is hit
+const char* skip_classic_whitespace_in_sequence(const char* it,
+                                                const char* end)
+{
+    while (it != end && impl::is_ascii_space(*it)) {
+        ++it;
+    }
+    if (SCN_UNLIKELY(it != end && !impl::is_ascii_char(*it))) {
+        auto rest = make_string_view_from_pointers(it, end);
+        return it + ranges::distance(rest.begin(),
+                                     impl::read_while_classic_space(rest));
+    }
+    return it;
+}
+
+// Reads up to `count` values separated by `separator` from `source`.
+// `read_value(it, end, i)` reads the `i`th value starting at `it`, and
+// returns the end of it. It returns a null pointer to end the sequence
+// without an error, if what follows a separator isn't a value at all:
+// errors it returns are always reported, along with the number of values
+// read before it, and the position of the value that failed.
+template <typename ReadValue>
+auto scan_separated_values(std::string_view source,
+                           std::size_t count,
+                           char separator,
+                           ReadValue read_value) -> scan_sequence_expected
+{
+    const char* it = source.data();
+    const char* const end = source.data() + source.size();
+    // End of the last successfully read value
+    const char* last = it;
+    const bool separator_is_space = impl::is_ascii_space(separator);
+
+    const auto make_error = [&](scan_error err, std::size_t n) {
+        return unexpected(scan_sequence_error{
+            err, n, source.begin() + ranges::distance(source.data(), it)});
+    };
+
+    std::size_t n = 0;
+    for (; n != count; ++n) {
+        if (n == 0) {
+            it = skip_classic_whitespace_in_sequence(it, end);
+            if (SCN_UNLIKELY(it == end)) {
+                return make_error({scan_error::end_of_input, "EOF"}, n);
+            }
+        }
+        else if (separator_is_space) {
+            auto next = skip_classic_whitespace_in_sequence(it, end);
+            if (next == it || next == end) {
+                break;
+            }
+            it = next;
+        }
+        else {
+            it = skip_classic_whitespace_in_sequence(it, end);
+            if (it == end || *it != separator) {
+                break;
+            }
+            it = skip_classic_whitespace_in_sequence(it + 1, end);
+            if (it == end) {
+                break;
+            }
+        }
+
+        auto value_end = read_value(it, end, n);
+        if (SCN_UNLIKELY(!value_end)) {
+            return make_error(value_end.error(), n);
+        }
+        if (!*value_end) {
+            // Whatever follows the separator isn't ours to read
+            SCN_EXPECT(n != 0);
+            break;
+        }
+        it = *value_end;
+        last = it;
+    }
+
+    return std::pair{source.begin() + ranges::distance(source.data(), last),
+                     n};
+}
+}  // namespace
+
+template <typename T>
+auto scan_ints_impl(std::string_view source,
+                    T* out,
+                    std::size_t count,
+                    char separator)
+    -> scan_sequence_expected
+{
+    return scan_separated_values(
+        source, count, separator,
+        [out](const char* it, const char* end,
+              std::size_t i) -> scan_expected<const char*> {
+            auto sign = impl::sign_type::plus_sign;
+            if (*it == '-' || *it == '+') {
+                if (*it == '-') {
+                    sign = impl::sign_type::minus_sign;
+                }
+                ++it;
+            }
+            if (it == end || impl::char_to_int(*it) >= 10) {
+                if (i == 0) {
+                    SCN_UNLIKELY_ATTR
+                    return unexpected_scan_error(
+                        scan_error::invalid_scanned_value,
+                        "Invalid integer value");
+                }
+                return nullptr;
+            }
+
+            if constexpr (!std::is_signed_v<T>) {
+                if (sign == impl::sign_type::minus_sign) {
+                    SCN_UNLIKELY_ATTR
+                    return unexpected_scan_error(
+                        scan_error::invalid_scanned_value,
+                        "Unexpected '-' sign when parsing an unsigned value");
+                }
+            }
+
+            auto digits = make_string_view_from_pointers(it, end);
+            SCN_TRY(digits_end,
+                    impl::parse_integer_value(digits, out[i], sign, 10));
+            return it + ranges::distance(digits.begin(), digits_end);
+        });
+}
+
+namespace {
+// Characters, which can't be a part of a float,
+// so that a separator like this can end the input given to the reader
+constexpr bool can_bound_float_with_separator(char separator)
+{
+    return impl::char_to_int(separator) >= 36 && separator != '.' &&
+           separator != '+' && separator != '-' && separator != '(' &&
+           separator != ')' && separator != '_';
+}
+
+// Whether `ch` can be the first character of a float:
+// a sign, a digit, a decimal point, or the start of "inf" or "nan"
+constexpr bool can_begin_float(char ch)
+{
+    return impl::char_to_int(ch) < 10 || ch == '.' || ch == '+' ||
+           ch == '-' || ch == 'i' || ch == 'I' || ch == 'n' || ch == 'N';
+}
+}  // namespace
+
+template <typename T>
+auto scan_floats_impl(std::string_view source,
+                      T* out,
+                      std::size_t count,
+                      char separator)
+    -> scan_sequence_expected
+{
+    // Without a bound, the strtod fallback would copy the entire rest of
+    // the input for every value, if the values aren't separated by spaces
+    const bool bound_values = !impl::is_ascii_space(separator) &&
+                              can_bound_float_with_separator(separator);
+
+    return scan_separated_values(
+        source, count, separator,
+        [out, separator, bound_values](
+            const char* it, const char* end,
+            std::size_t i) -> scan_expected<const char*> {
+            if (bound_values) {
+                if (auto sep = static_cast<const char*>(std::memchr(
+                        it, separator, static_cast<std::size_t>(end - it)))) {
+                    end = sep;
+                }
+                if (it == end) {
+                    if (i == 0) {
+                        SCN_UNLIKELY_ATTR
+                        return unexpected_scan_error(
+                            scan_error::invalid_scanned_value,
+                            "Invalid float value");
+                    }
+                    return nullptr;
+                }
+            }
+
+            if (i != 0 && !can_begin_float(*it)) {
+                return nullptr;
+            }
+
+            auto value_source = make_string_view_from_pointers(it, end);
+            auto reader = impl::float_reader<char>{};
+            if (auto r = reader.read_source(value_source, {});
+                SCN_UNLIKELY(!r)) {
+                return unexpected(r.error());
+            }
+            SCN_TRY(n, reader.parse_value(out[i]));
+            return it + n;
+        });
+}
 }  // namespace detail
 
 scan_expected<void> vinput(std::string_view format, scan_args args)
 {
     auto buffer = detail::make_file_scan_buffer(stdin);
+    const auto valid_encoding_scope = impl::assume_valid_encoding_scope{buffer};
     auto n = vscan_internal(buffer, format, args);
     if (n) {
         if (SCN_UNLIKELY(!buffer.sync(*n))) {
@@ -2941,6 +4753,11 @@ scan_expected<std::ptrdiff_t> sync_after_vscan(
                 "Failed to sync with underlying source");
         }
     }
+    if (SCN_UNLIKELY(source.has_read_error())) {
+        return detail::unexpected_scan_error(
+            scan_error::invalid_source_state,
+            "Failed to read from underlying source");
+    }
     return result;
 }
 
@@ -2950,26 +4767,58 @@ scan_expected<std::ptrdiff_t> vscan_impl(std::string_view source,
                                          std::string_view format,
                                          scan_args args)
 {
+    const auto valid_encoding_scope = impl::assume_valid_encoding_scope{source};
     return vscan_internal(source, format, args);
 }
 scan_expected<std::ptrdiff_t> vscan_impl(scan_buffer& source,
                                          std::string_view format,
                                          scan_args args)
 {
+    const auto valid_encoding_scope = impl::assume_valid_encoding_scope{source};
     auto n = vscan_internal(source, format, args);
     return sync_after_vscan(source, n);
 }
 
+scan_expected<std::ptrdiff_t> vscan_compiled_impl(
+    std::string_view source,
+    compiled_format_view<char> format,
+    scan_args args)
+{
+    const auto valid_encoding_scope = impl::assume_valid_encoding_scope{source};
+    return vscan_compiled_internal(source, format, args);
+}
+scan_expected<std::ptrdiff_t> vscan_compiled_impl(
+    scan_buffer& source,
+    compiled_format_view<char> format,
+    scan_args args)
+{
+    const auto valid_encoding_scope = impl::assume_valid_encoding_scope{source};
+    auto n = vscan_compiled_internal(source, format, args);
+    return sync_after_vscan(source, n);
+}
+
+scan_expected<void> parse_charset_nonascii_ranges(
+    std::string_view charset,
+    std::vector<std::pair<char32_t, char32_t>>& ranges)
+{
+    auto handler = impl::nonascii_specs_handler{};
+    SCN_TRY_DISCARD(impl::parse_charset_nonascii_ranges(charset, handler));
+    ranges = SCN_MOVE(handler.extra_ranges);
+    return {};
+}
+
 scan_expected<std::ptrdiff_t> vscan_impl(std::wstring_view source,
                                          std::wstring_view format,
                                          wscan_args args)
 {
+    const auto valid_encoding_scope = impl::assume_valid_encoding_scope{source};
     return vscan_internal(source, format, args);
 }
 scan_expected<std::ptrdiff_t> vscan_impl(wscan_buffer& source,
                                          std::wstring_view format,
                                          wscan_args args)
 {
+    const auto valid_encoding_scope = impl::assume_valid_encoding_scope{source};
     auto n = vscan_internal(source, format, args);
     return sync_after_vscan(source, n);
 }
@@ -2981,6 +4830,7 @@ scan_expected<std::ptrdiff_t> vscan_localized_impl(const Locale& loc,
                                                    std::string_view format,
                                                    scan_args args)
 {
+    const auto valid_encoding_scope = impl::assume_valid_encoding_scope{source};
     return vscan_internal(source, format, args, detail::locale_ref{loc});
 }
 template <typename Locale>
@@ -2989,6 +4839,7 @@ scan_expected<std::ptrdiff_t> vscan_localized_impl(const Locale& loc,
                                                    std::string_view format,
                                                    scan_args args)
 {
+    const auto valid_encoding_scope = impl::assume_valid_encoding_scope{source};
     auto n = vscan_internal(source, format, args, detail::locale_ref{loc});
     return sync_after_vscan(source, n);
 }
@@ -2999,6 +4850,7 @@ scan_expected<std::ptrdiff_t> vscan_localized_impl(const Locale& loc,
                                                    std::wstring_view format,
                                                    wscan_args args)
 {
+    const auto valid_encoding_scope = impl::assume_valid_encoding_scope{source};
     return vscan_internal(source, format, args, detail::locale_ref{loc});
 }
 template <typename Locale>
@@ -3007,6 +4859,7 @@ scan_expected<std::ptrdiff_t> vscan_localized_impl(const Locale& loc,
                                                    std::wstring_view format,
                                                    wscan_args args)
 {
+    const auto valid_encoding_scope = impl::assume_valid_encoding_scope{source};
     auto n = vscan_internal(source, format, args, detail::locale_ref{loc});
     return sync_after_vscan(source, n);
 }
@@ -3036,11 +4889,13 @@ template auto vscan_localized_impl<std::locale>(const std::locale&,
 scan_expected<std::ptrdiff_t> vscan_value_impl(std::string_view source,
                                                basic_scan_arg<scan_context> arg)
 {
+    const auto valid_encoding_scope = impl::assume_valid_encoding_scope{source};
     return vscan_value_internal(source, arg);
 }
 scan_expected<std::ptrdiff_t> vscan_value_impl(scan_buffer& source,
                                                basic_scan_arg<scan_context> arg)
 {
+    const auto valid_encoding_scope = impl::assume_valid_encoding_scope{source};
     auto n = vscan_value_internal(source, arg);
     return sync_after_vscan(source, n);
 }
@@ -3049,12 +4904,14 @@ scan_expected<std::ptrdiff_t> vscan_value_impl(
     std::wstring_view source,
     basic_scan_arg<wscan_context> arg)
 {
+    const auto valid_encoding_scope = impl::assume_valid_encoding_scope{source};
     return vscan_value_internal(source, arg);
 }
 scan_expected<std::ptrdiff_t> vscan_value_impl(
     wscan_buffer& source,
     basic_scan_arg<wscan_context> arg)
 {
+    const auto valid_encoding_scope = impl::assume_valid_encoding_scope{source};
     auto n = vscan_value_internal(source, arg);
     return sync_after_vscan(source, n);
 }
@@ -3062,52 +4919,72 @@ scan_expected<std::ptrdiff_t> vscan_value_impl(
 #if !SCN_DISABLE_TYPE_SCHAR
 template auto scan_int_impl(std::string_view, signed char&, int)
     -> scan_expected<std::string_view::iterator>;
+template auto scan_ints_impl(std::string_view, signed char*, std::size_t, char)
+    -> scan_sequence_expected;
 template auto scan_int_exhaustive_valid_impl(std::string_view) -> signed char;
 #endif
 #if !SCN_DISABLE_TYPE_SHORT
 template auto scan_int_impl(std::string_view, short&, int)
     -> scan_expected<std::string_view::iterator>;
+template auto scan_ints_impl(std::string_view, short*, std::size_t, char)
+    -> scan_sequence_expected;
 template auto scan_int_exhaustive_valid_impl(std::string_view) -> short;
 #endif
 #if !SCN_DISABLE_TYPE_INT
 template auto scan_int_impl(std::string_view, int&, int)
     -> scan_expected<std::string_view::iterator>;
+template auto scan_ints_impl(std::string_view, int*, std::size_t, char)
+    -> scan_sequence_expected;
 template auto scan_int_exhaustive_valid_impl(std::string_view) -> int;
 #endif
 #if !SCN_DISABLE_TYPE_LONG
 template auto scan_int_impl(std::string_view, long&, int)
     -> scan_expected<std::string_view::iterator>;
+template auto scan_ints_impl(std::string_view, long*, std::size_t, char)
+    -> scan_sequence_expected;
 template auto scan_int_exhaustive_valid_impl(std::string_view) -> long;
 #endif
 #if !SCN_DISABLE_TYPE_LONG_LONG
 template auto scan_int_impl(std::string_view, long long&, int)
     -> scan_expected<std::string_view::iterator>;
+template auto scan_ints_impl(std::string_view, long long*, std::size_t, char)
+    -> scan_sequence_expected;
 template auto scan_int_exhaustive_valid_impl(std::string_view) -> long long;
 #endif
 #if !SCN_DISABLE_TYPE_UCHAR
 template auto scan_int_impl(std::string_view, unsigned char&, int)
     -> scan_expected<std::string_view::iterator>;
+template auto scan_ints_impl(std::string_view, unsigned char*, std::size_t, char)
+    -> scan_sequence_expected;
 template auto scan_int_exhaustive_valid_impl(std::string_view) -> unsigned char;
 #endif
 #if !SCN_DISABLE_TYPE_USHORT
 template auto scan_int_impl(std::string_view, unsigned short&, int)
     -> scan_expected<std::string_view::iterator>;
+template auto scan_ints_impl(std::string_view, unsigned short*, std::size_t, char)
+    -> scan_sequence_expected;
 template auto scan_int_exhaustive_valid_impl(std::string_view)
     -> unsigned short;
 #endif
 #if !SCN_DISABLE_TYPE_UINT
 template auto scan_int_impl(std::string_view, unsigned int&, int)
     -> scan_expected<std::string_view::iterator>;
+template auto scan_ints_impl(std::string_view, unsigned int*, std::size_t, char)
+    -> scan_sequence_expected;
 template auto scan_int_exhaustive_valid_impl(std::string_view) -> unsigned int;
 #endif
 #if !SCN_DISABLE_TYPE_ULONG
 template auto scan_int_impl(std::string_view, unsigned long&, int)
     -> scan_expected<std::string_view::iterator>;
+template auto scan_ints_impl(std::string_view, unsigned long*, std::size_t, char)
+    -> scan_sequence_expected;
 template auto scan_int_exhaustive_valid_impl(std::string_view) -> unsigned long;
 #endif
 #if !SCN_DISABLE_TYPE_ULONG_LONG
 template auto scan_int_impl(std::string_view, unsigned long long&, int)
     -> scan_expected<std::string_view::iterator>;
+template auto scan_ints_impl(std::string_view, unsigned long long*, std::size_t, char)
+    -> scan_sequence_expected;
 template auto scan_int_exhaustive_valid_impl(std::string_view)
     -> unsigned long long;
 #endif
@@ -3117,13 +4994,30 @@ template auto scan_int_exhaustive_valid_impl(std::string_view)
 #if !SCN_DISABLE_TYPE_INT128
 template auto scan_int_impl(std::string_view, int128&, int)
     -> scan_expected<std::string_view::iterator>;
+template auto scan_ints_impl(std::string_view, int128*, std::size_t, char)
+    -> scan_sequence_expected;
 #endif
 
 #if !SCN_DISABLE_TYPE_UINT128
 template auto scan_int_impl(std::string_view, uint128&, int)
     -> scan_expected<std::string_view::iterator>;
+template auto scan_ints_impl(std::string_view, uint128*, std::size_t, char)
+    -> scan_sequence_expected;
+#endif
+
 #endif
 
+#if !SCN_DISABLE_TYPE_FLOAT
+template auto scan_floats_impl(std::string_view, float*, std::size_t, char)
+    -> scan_sequence_expected;
+#endif
+#if !SCN_DISABLE_TYPE_DOUBLE
+template auto scan_floats_impl(std::string_view, double*, std::size_t, char)
+    -> scan_sequence_expected;
+#endif
+#if !SCN_DISABLE_TYPE_LONG_DOUBLE
+template auto scan_floats_impl(std::string_view, long double*, std::size_t, char)
+    -> scan_sequence_expected;
 #endif
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3790,6 +5684,220 @@ struct datetime_setter<year_month_day>
     }
 };
 
+// ISO 8601 / RFC 3339 timestamps, with a fixed layout, are common enough
+// (e.g. as the first field of every line of a log file)
+// to warrant a reader of their own, in addition to the generic tm_reader.
+
+template <typename CharT>
+bool consume_chrono_format_prefix(std::basic_string_view<CharT>& fmt,
+                                  std::string_view prefix)
+{
+    if (fmt.size() < prefix.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < prefix.size(); ++i) {
+        if (fmt[i] != static_cast<CharT>(prefix[i])) {
+            return false;
+        }
+    }
+    fmt.remove_prefix(prefix.size());
+    return true;
+}
+
+/// Recognizes `%Y-%m-%dT%H:%M:%S`, with `%F` and `%T` as alternative
+/// spellings, a space instead of `T`, `%.S` instead of `%S`,
+/// and an optional trailing `%z`.
+template <typename CharT>
+std::optional<iso8601_layout> detect_iso8601_layout(
+    std::basic_string_view<CharT> fmt)
+{
+    iso8601_layout layout{};
+    if (!consume_chrono_format_prefix(fmt, "%Y-%m-%d") &&
+        !consume_chrono_format_prefix(fmt, "%F")) {
+        return std::nullopt;
+    }
+
+    if (consume_chrono_format_prefix(fmt, " ")) {
+        layout.separator = ' ';
+    }
+    else if (!consume_chrono_format_prefix(fmt, "T")) {
+        return std::nullopt;
+    }
+
+    if (consume_chrono_format_prefix(fmt, "%H:%M:%.S")) {
+        layout.subsec = true;
+    }
+    else if (!consume_chrono_format_prefix(fmt, "%H:%M:%S") &&
+             !consume_chrono_format_prefix(fmt, "%T")) {
+        return std::nullopt;
+    }
+
+    layout.tz_offset = consume_chrono_format_prefix(fmt, "%z");
+    if (!fmt.empty()) {
+        return std::nullopt;
+    }
+    return layout;
+}
+
+struct iso8601_datetime {
+    int year, mon, mday, hour, min, sec;
+};
+
+/// Number of code units in `YYYY-MM-DDTHH:MM:SS`
+constexpr std::ptrdiff_t iso8601_datetime_length = 19;
+
+template <typename CharT>
+constexpr bool is_ascii_digit(CharT ch)
+{
+    return ch >= CharT{'0'} && ch <= CharT{'9'};
+}
+
+template <typename CharT>
+constexpr int two_ascii_digits_value(const CharT* p)
+{
+    return static_cast<int>(p[0] - CharT{'0'}) * 10 +
+           static_cast<int>(p[1] - CharT{'0'});
+}
+
+/// Parse `YYYY-MM-DD<separator>HH:MM:SS` at `p`,
+/// which must have at least `iso8601_datetime_length` code units available.
+/// Only checks the layout, not the ranges of the values.
+template <typename CharT>
+bool parse_iso8601_datetime(const CharT* p,
+                            char separator,
+                            iso8601_datetime& dt)
+{
+    for (int i : {0, 1, 2, 3, 5, 6, 8, 9, 11, 12, 14, 15, 17, 18}) {
+        if (!is_ascii_digit(p[i])) {
+            return false;
+        }
+    }
+    if (p[4] != CharT{'-'} || p[7] != CharT{'-'} ||
+        p[10] != static_cast<CharT>(separator) || p[13] != CharT{':'} ||
+        p[16] != CharT{':'}) {
+        return false;
+    }
+
+    dt.year = two_ascii_digits_value(p) * 100 + two_ascii_digits_value(p + 2);
+    dt.mon = two_ascii_digits_value(p + 5);
+    dt.mday = two_ascii_digits_value(p + 8);
+    dt.hour = two_ascii_digits_value(p + 11);
+    dt.min = two_ascii_digits_value(p + 14);
+    dt.sec = two_ascii_digits_value(p + 17);
+    return true;
+}
+
+/// SWAR: `YYYY-MM-` and `HH:MM:SS` are read as 64-bit words,
+/// the separators are checked and replaced with zeroes,
+/// and the remaining digits are converted all at once.
+inline bool parse_iso8601_datetime(const char* p,
+                                   char separator,
+                                   iso8601_datetime& dt)
+{
+    // Separators at bytes 4 and 7 of `YYYY-MM-`
+    constexpr uint64_t date_sep_mask = 0xff0000ff00000000;
+    constexpr uint64_t date_seps = 0x2d00002d00000000;
+    // Separators at bytes 2 and 5 of `HH:MM:SS`
+    constexpr uint64_t time_sep_mask = 0x0000ff0000ff0000;
+    constexpr uint64_t time_seps = 0x00003a00003a0000;
+    constexpr uint64_t zeroes = 0x3030303030303030;
+
+    auto date_word = impl::get_eight_digits_word(p);
+    auto time_word = impl::get_eight_digits_word(p + 11);
+    if ((date_word & date_sep_mask) != date_seps ||
+        (time_word & time_sep_mask) != time_seps || p[10] != separator ||
+        !is_ascii_digit(p[8]) || !is_ascii_digit(p[9])) {
+        return false;
+    }
+
+    date_word = (date_word & ~date_sep_mask) | (zeroes & date_sep_mask);
+    time_word = (time_word & ~time_sep_mask) | (zeroes & time_sep_mask);
+    if (!impl::is_word_made_of_eight_decimal_digits_fast(date_word) ||
+        !impl::is_word_made_of_eight_decimal_digits_fast(time_word)) {
+        return false;
+    }
+
+    // YYYY0MM0
+    const auto date = impl::parse_eight_decimal_digits_unrolled_fast(date_word);
+    // HH0MM0SS
+    const auto time = impl::parse_eight_decimal_digits_unrolled_fast(time_word);
+    dt.year = static_cast<int>(date / 10000);
+    dt.mon = static_cast<int>(date / 10 % 100);
+    dt.mday = two_ascii_digits_value(p + 8);
+    dt.hour = static_cast<int>(time / 1000000);
+    dt.min = static_cast<int>(time / 1000 % 100);
+    dt.sec = static_cast<int>(time % 100);
+    return true;
+}
+
+constexpr bool is_valid_iso8601_datetime(const iso8601_datetime& dt)
+{
+    return dt.mon >= 1 && dt.mon <= 12 && dt.mday >= 1 && dt.mday <= 31 &&
+           dt.hour <= 23 && dt.min <= 59 && dt.sec <= 60;
+}
+
+/// Parse `.fff` (`%.S` after the whole seconds) at `p`.
+template <typename CharT>
+bool read_iso8601_subsec(const CharT*& p, const CharT* end, double& subsec)
+{
+    if (p == end || *p != CharT{'.'}) {
+        return false;
+    }
+    auto it = p + 1;
+
+    // Up to 15 digits fit in the 53-bit mantissa of a double:
+    // the division below is then rounded correctly,
+    // like it would be with the generic reader
+    constexpr double powers_of_ten[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                        1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                        1e12, 1e13, 1e14, 1e15};
+    const auto digits_begin = it;
+    uint64_t digits = 0;
+    while (it != end && is_ascii_digit(*it) && it - digits_begin < 16) {
+        digits = digits * 10 + static_cast<uint64_t>(*it - CharT{'0'});
+        ++it;
+    }
+    const auto digit_count = it - digits_begin;
+    if (digit_count == 0 || digit_count > 15) {
+        return false;
+    }
+    subsec = static_cast<double>(digits) / powers_of_ten[digit_count];
+    p = it;
+    return true;
+}
+
+/// Parse `[+|-]hh[[:]mm]` (`%z`) at `p`, requiring a sign.
+template <typename CharT>
+bool read_iso8601_tz_offset(const CharT*& p, const CharT* end, int& offset)
+{
+    if (end - p < 3 || (*p != CharT{'+'} && *p != CharT{'-'}) ||
+        !is_ascii_digit(p[1]) || !is_ascii_digit(p[2])) {
+        return false;
+    }
+    const bool is_minus = *p == CharT{'-'};
+    int minutes = two_ascii_digits_value(p + 1) * 60;
+    auto it = p + 3;
+    if (it != end && *it == CharT{':'}) {
+        if (end - it >= 3 && is_ascii_digit(it[1]) && is_ascii_digit(it[2])) {
+            minutes += two_ascii_digits_value(it + 1);
+            it += 3;
+        }
+        else if (it + 1 != end && is_ascii_digit(it[1])) {
+            return false;
+        }
+    }
+    else if (it != end && is_ascii_digit(*it)) {
+        if (end - it < 2 || !is_ascii_digit(it[1])) {
+            return false;
+        }
+        minutes += two_ascii_digits_value(it);
+        it += 2;
+    }
+    offset = is_minus ? -minutes : minutes;
+    p = it;
+    return true;
+}
+
 template <typename T, typename Range, typename CharT>
 class tm_reader {
 public:
@@ -4460,6 +6568,59 @@ public:
         unimplemented();
     }
 
+    /**
+     * Read a timestamp with the layout `layout` in a single pass,
+     * instead of going through the format string field by field.
+     *
+     * Only handles the exact, fixed-width layout (e.g. two-digit months and
+     * a signed `%z`). Returns `false` without consuming any input otherwise,
+     * and reading is then done again with the generic reader,
+     * which also reports any errors.
+     */
+    bool read_iso8601(const iso8601_layout& layout)
+    {
+        if constexpr (!std::is_same_v<iterator, const CharT*>) {
+            SCN_UNUSED(layout);
+            return false;
+        }
+        else {
+            const CharT* p = m_begin;
+            const CharT* const end = m_range.end();
+            iso8601_datetime dt{};
+            if (end - p < iso8601_datetime_length ||
+                !parse_iso8601_datetime(p, layout.separator, dt)) {
+                return false;
+            }
+            p += iso8601_datetime_length;
+
+            double subsec = 0.0;
+            if (layout.subsec && !read_iso8601_subsec(p, end, subsec)) {
+                return false;
+            }
+            int tz_offset = 0;
+            if (layout.tz_offset &&
+                !read_iso8601_tz_offset(p, end, tz_offset)) {
+                return false;
+            }
+
+            setter::set_full_year(*this, m_tm, m_st, dt.year);
+            setter::set_mon(*this, m_tm, m_st, dt.mon);
+            setter::set_mday(*this, m_tm, m_st, dt.mday);
+            setter::set_hour24(*this, m_tm, m_st, dt.hour);
+            setter::set_min(*this, m_tm, m_st, dt.min);
+            setter::set_sec(*this, m_tm, m_st, dt.sec);
+            if (layout.subsec) {
+                setter::set_subsec(*this, m_tm, m_st, subsec);
+            }
+            if (layout.tz_offset) {
+                setter::set_tz_offset(*this, m_tm, m_st,
+                                      std::chrono::minutes{tz_offset});
+            }
+            m_begin = p;
+            return true;
+        }
+    }
+
     void verify()
     {
         m_st.verify(*this);
@@ -4707,7 +6868,14 @@ auto chrono_scan_inner_impl(std::basic_string_view<CharT> fmt,
 
     auto r = detail::tm_reader<T, typename Context::range_type, CharT>(
         ctx.range(), t, ctx.locale());
-    detail::parse_chrono_format_specs(fmt.data(), fmt.data() + fmt.size(), r);
+    if (auto layout = detect_iso8601_layout(fmt);
+        layout && r.read_iso8601(*layout)) {
+        r.verify();
+    }
+    else {
+        detail::parse_chrono_format_specs(fmt.data(), fmt.data() + fmt.size(),
+                                          r);
+    }
     if (auto e = r.get_error(); SCN_UNLIKELY(!e)) {
         return unexpected(e.error());
     }
@@ -4748,6 +6916,72 @@ template auto chrono_scan_impl(std::wstring_view,
                                wscan_context&)
     -> scan_expected<wscan_context::iterator>;
 
+std::optional<iso8601_layout> detect_iso8601_timestamp_format(
+    std::string_view format)
+{
+    return detect_iso8601_layout(format);
+}
+
+bool read_timestamp_with_prefix_cache(const iso8601_layout& layout,
+                                      timestamp_prefix_cache& cache,
+                                      std::string_view source,
+                                      prefix_cached_timestamp& ts)
+{
+    const char* p = source.data();
+    const char* const end = source.data() + source.size();
+    if (end - p < iso8601_datetime_length) {
+        return false;
+    }
+
+    constexpr std::size_t prefix_length = sizeof(cache.prefix);
+    static_assert(prefix_length == 16);  // YYYY-MM-DDTHH:MM
+    int sec = 0;
+    if (cache.has_prefix &&
+        std::memcmp(p, cache.prefix, prefix_length) == 0) {
+        if (p[16] != ':' || !is_ascii_digit(p[17]) || !is_ascii_digit(p[18])) {
+            return false;
+        }
+        sec = two_ascii_digits_value(p + 17);
+        if (sec > 60) {
+            return false;
+        }
+    }
+    else {
+        iso8601_datetime dt{};
+        if (!parse_iso8601_datetime(p, layout.separator, dt) ||
+            !is_valid_iso8601_datetime(dt)) {
+            return false;
+        }
+        std::memcpy(cache.prefix, p, prefix_length);
+        cache.prefix_time = std::chrono::seconds{
+            days_from_civil(dt.year, static_cast<unsigned>(dt.mon), dt.mday) *
+                86400 +
+            dt.hour * 3600 + dt.min * 60};
+        cache.has_prefix = true;
+        sec = dt.sec;
+    }
+    p += iso8601_datetime_length;
+
+    ts.time = cache.prefix_time + std::chrono::seconds{sec};
+    ts.subsec.reset();
+    if (layout.subsec) {
+        double subsec{};
+        if (!read_iso8601_subsec(p, end, subsec)) {
+            return false;
+        }
+        ts.subsec = subsec;
+    }
+    if (layout.tz_offset) {
+        int offset{};
+        if (!read_iso8601_tz_offset(p, end, offset)) {
+            return false;
+        }
+        ts.time -= std::chrono::minutes{offset};
+    }
+    ts.end = p;
+    return true;
+}
+
 }  // namespace detail
 
 #endif  // !SCN_DISABLE_CHRONO
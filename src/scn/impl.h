@@ -26,6 +26,8 @@
 #include <cmath>
 #include <cwchar>
 #include <functional>
+#include <memory>
+#include <utility>
 #include <vector>
 
 #if SCN_HAS_BITOPS
@@ -1010,8 +1012,11 @@ bool is_segment_contiguous(Range r)
         }
         else {
             if (beg.stores_parent()) {
-                return beg.contiguous_segment().end() ==
-                       beg.parent()->current_view().end();
+                // A non-contiguous parent can still be filled past the end
+                // of its current view
+                return beg.parent()->is_contiguous() &&
+                       beg.contiguous_segment().end() ==
+                           beg.parent()->current_view().end();
             }
             return true;
         }
@@ -1250,8 +1255,97 @@ bool basic_scan_file_buffer<FileInterface>::sync(std::ptrdiff_t position)
     return true;
 }
 
+#if SCN_POSIX
+
+template <typename FdInterface>
+basic_scan_fd_buffer<FdInterface>::basic_scan_fd_buffer(FdInterface fd,
+                                                        std::size_t block_size)
+    : base(base::non_contiguous_tag{}), m_fd(SCN_MOVE(fd))
+{
+    m_block.resize(block_size != 0 ? block_size : 1);
+    // sync() only discards input, so it's safe to do after every scan
+    this->m_sync_after_scanning_range = true;
+}
+
+template <typename FdInterface>
+bool basic_scan_fd_buffer<FdInterface>::fill()
+{
+    if (!this->m_current_view.empty()) {
+        this->m_putback_buffer.insert(this->m_putback_buffer.end(),
+                                      this->m_current_view.begin(),
+                                      this->m_current_view.end());
+    }
+
+    if (SCN_UNLIKELY(m_read_error != 0)) {
+        this->m_current_view = {};
+        return false;
+    }
+
+    const auto n = m_fd.read(m_block.data(), m_block.size());
+    if (n <= 0) {
+        if (SCN_UNLIKELY(n < 0)) {
+            m_read_error = m_fd.error;
+        }
+        this->m_current_view = {};
+        return false;
+    }
+
+    this->m_current_view = {m_block.data(), static_cast<std::size_t>(n)};
+    return true;
+}
+
+#endif  // SCN_POSIX
+
 }  // namespace detail
 
+/////////////////////////////////////////////////////////////////
+// Kernel dispatch
+/////////////////////////////////////////////////////////////////
+
+namespace impl {
+enum class kernel_isa { scalar, sse2, avx2, avx512bw, neon };
+
+/**
+ * Implementations of the hot loops in impl.cpp for a single instruction set.
+ * The best one supported by the CPU is selected at runtime, so that
+ * a portable build doesn't need -march to use wider instructions.
+ */
+struct kernel_dispatch_table {
+    kernel_isa isa;
+
+    // Index of the first code unit in [data, data + size) that's either
+    // non-ASCII or in the character class, or size if there's none
+    std::size_t (*find_classic_space_or_nonascii)(const char*, std::size_t);
+    std::size_t (*find_classic_nonspace_or_nonascii)(const char*,
+                                                     std::size_t);
+    std::size_t (*find_nondecimal_digit)(const char*, std::size_t);
+    std::size_t (*find_nonascii)(const char*, std::size_t);
+
+    // Accumulates the decimal digits at the beginning of [begin, end)
+    // into val, returns the end of the digits
+    const char* (*parse_decimal_digits)(const char*, const char*, uint64_t&);
+
+    bool (*validate_utf8)(const char*, std::size_t);
+
+    // Widen or narrow the ASCII code units at the beginning of a string,
+    // in whole vector-sized blocks: stops at the first block with
+    // non-ASCII in it, and may leave a tail shorter than a block.
+    // Returns the number of code units converted (0 for scalar).
+    // The UTF-16 and UTF-32 side is an array of 2- or 4-byte code units.
+    std::size_t (*widen_ascii_to_utf16)(const char*, std::size_t, void*);
+    std::size_t (*widen_ascii_to_utf32)(const char*, std::size_t, void*);
+    std::size_t (*narrow_ascii_from_utf32)(const void*, std::size_t, char*);
+};
+
+bool is_kernel_isa_supported(kernel_isa isa);
+
+const kernel_dispatch_table& get_kernel_dispatch_table(kernel_isa isa);
+
+// Table for the best instruction set supported by the CPU,
+// detected on first use
+const kernel_dispatch_table& get_kernel_dispatch_table();
+}  // namespace impl
+
 /////////////////////////////////////////////////////////////////
 // Unicode
 /////////////////////////////////////////////////////////////////
@@ -1282,6 +1376,73 @@ constexpr bool validate_unicode(std::basic_string_view<CharT> src)
     return true;
 }
 
+inline bool validate_unicode(std::string_view src)
+{
+    return get_kernel_dispatch_table().validate_utf8(src.data(), src.size());
+}
+
+/**
+ * Sets whether string readers skip validation for the duration of a scan:
+ * only if scanning from a buffer that `assumes_valid_encoding()`.
+ *
+ * Readers over a contiguous buffer only see pointers, not the buffer,
+ * so the flag is kept per thread. Every scan sets it for its own source
+ * once, in the `vscan` entry points, and restores the previous value when
+ * done, so that a scan nested in a trusted one (e.g. in a custom scanner)
+ * still validates its own input. The flag is only written if it changes,
+ * which it usually doesn't.
+ */
+class assume_valid_encoding_scope {
+public:
+    template <typename CharT>
+    explicit assume_valid_encoding_scope(
+        const detail::basic_scan_buffer<CharT>& buffer)
+        : assume_valid_encoding_scope(buffer.assumes_valid_encoding())
+    {
+    }
+
+    // A plain string source is never trusted
+    template <typename CharT>
+    explicit assume_valid_encoding_scope(std::basic_string_view<CharT>)
+        : assume_valid_encoding_scope(false)
+    {
+    }
+
+    assume_valid_encoding_scope(const assume_valid_encoding_scope&) = delete;
+    assume_valid_encoding_scope& operator=(const assume_valid_encoding_scope&) =
+        delete;
+
+    ~assume_valid_encoding_scope()
+    {
+        if (SCN_UNLIKELY(m_changed)) {
+            flag() = m_previous;
+        }
+    }
+
+    static bool is_active()
+    {
+        return flag();
+    }
+
+private:
+    static bool& flag()
+    {
+        thread_local bool value{false};
+        return value;
+    }
+
+    explicit assume_valid_encoding_scope(bool value)
+        : m_previous(flag()), m_changed(m_previous != value)
+    {
+        if (SCN_UNLIKELY(m_changed)) {
+            flag() = value;
+        }
+    }
+
+    bool m_previous;
+    bool m_changed;
+};
+
 template <typename Range>
 constexpr auto get_start_for_next_code_point(Range input)
     -> ranges::const_iterator_t<Range>
@@ -1410,6 +1571,118 @@ void transcode_valid_to_string_impl_to32(
     }
 }
 
+// Number of code units a vector transcoding kernel converts at a time,
+// at most: scalar conversion is done up to the next multiple of it,
+// before trying the kernel again
+inline constexpr std::size_t transcode_kernel_block_size = 32;
+
+template <typename DestCharT>
+DestCharT* encode_code_point_as_utf16_or_32(char32_t cp, DestCharT* out)
+{
+    static_assert(sizeof(DestCharT) == 2 || sizeof(DestCharT) == 4);
+
+    if constexpr (sizeof(DestCharT) == 4) {
+        *out = static_cast<DestCharT>(cp);
+        return out + 1;
+    }
+    else {
+        if (cp < 0x10000) {
+            *out = static_cast<DestCharT>(cp);
+            return out + 1;
+        }
+        const auto u32cp = static_cast<uint32_t>(cp) - 0x10000;
+        out[0] = static_cast<DestCharT>(0xd800 + (u32cp >> 10));
+        out[1] = static_cast<DestCharT>(0xdc00 + (u32cp & 0x3ff));
+        return out + 2;
+    }
+}
+
+template <typename DestCharT>
+DestCharT* encode_code_point_as_utf8(char32_t cp, DestCharT* out)
+{
+    static_assert(sizeof(DestCharT) == 1);
+
+    const auto u32cp = static_cast<uint32_t>(cp);
+    if (cp < 0x80) {
+        *out = static_cast<DestCharT>(u32cp);
+        return out + 1;
+    }
+    if (cp < 0x800) {
+        out[0] = static_cast<DestCharT>(0xc0 | (u32cp >> 6));
+        out[1] = static_cast<DestCharT>(0x80 | (u32cp & 0x3f));
+        return out + 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = static_cast<DestCharT>(0xe0 | (u32cp >> 12));
+        out[1] = static_cast<DestCharT>(0x80 | ((u32cp >> 6) & 0x3f));
+        out[2] = static_cast<DestCharT>(0x80 | (u32cp & 0x3f));
+        return out + 3;
+    }
+    out[0] = static_cast<DestCharT>(0xf0 | (u32cp >> 18));
+    out[1] = static_cast<DestCharT>(0x80 | ((u32cp >> 12) & 0x3f));
+    out[2] = static_cast<DestCharT>(0x80 | ((u32cp >> 6) & 0x3f));
+    out[3] = static_cast<DestCharT>(0x80 | (u32cp & 0x3f));
+    return out + 4;
+}
+
+// UTF-8 to UTF-16 or UTF-32, written directly into `dest`,
+// widening runs of ASCII with the vector kernels
+template <bool VerifiedValid, typename SourceCharT, typename DestCharT>
+void transcode_to_string_impl_8to16_or_32(
+    std::basic_string_view<SourceCharT> src,
+    std::basic_string<DestCharT>& dest)
+{
+    static_assert(sizeof(SourceCharT) == 1);
+    static_assert(sizeof(DestCharT) == 2 || sizeof(DestCharT) == 4);
+
+    const auto widen_ascii =
+        sizeof(DestCharT) == 2
+            ? get_kernel_dispatch_table().widen_ascii_to_utf16
+            : get_kernel_dispatch_table().widen_ascii_to_utf32;
+
+    // A code point never takes less UTF-8 code units than UTF-16 or UTF-32
+    // ones, and the replacement character takes the place of at least one
+    const auto start = dest.size();
+    dest.resize(start + src.size());
+    auto* out = dest.data() + start;
+
+    const auto* data = reinterpret_cast<const char*>(src.data());
+    std::size_t i = 0;
+    while (i < src.size()) {
+        const auto n = widen_ascii(data + i, src.size() - i, out);
+        i += n;
+        out += n;
+
+        const auto scalar_end =
+            (std::min)(src.size(), i + transcode_kernel_block_size);
+        while (i < scalar_end) {
+            if (is_ascii_char(data[i])) {
+                *out++ = static_cast<DestCharT>(data[i]);
+                ++i;
+                continue;
+            }
+
+            const auto rest = src.substr(i);
+            char32_t cp{};
+            if constexpr (VerifiedValid) {
+                const auto res = get_next_code_point_valid(rest);
+                cp = res.value;
+                i += static_cast<std::size_t>(res.iterator - rest.begin());
+            }
+            else {
+                const auto res = get_next_code_point(rest);
+                cp = res.value;
+                i += static_cast<std::size_t>(res.iterator - rest.begin());
+                if (SCN_UNLIKELY(cp == detail::invalid_code_point)) {
+                    cp = 0xfffd;
+                }
+            }
+            out = encode_code_point_as_utf16_or_32(cp, out);
+        }
+    }
+    dest.resize(static_cast<std::size_t>(out - dest.data()));
+}
+
 template <bool VerifiedValid, typename SourceCharT, typename DestCharT>
 void transcode_to_string_impl_32to8(std::basic_string_view<SourceCharT> src,
                                     std::basic_string<DestCharT>& dest)
@@ -1417,43 +1690,46 @@ void transcode_to_string_impl_32to8(std::basic_string_view<SourceCharT> src,
     static_assert(sizeof(SourceCharT) == 4);
     static_assert(sizeof(DestCharT) == 1);
 
-    for (auto cp : src) {
-        const auto u32cp = static_cast<uint32_t>(cp);
-        if (SCN_UNLIKELY(!VerifiedValid && static_cast<char32_t>(cp) >=
-                                               detail::invalid_code_point)) {
-            // Replacement character
-            dest.push_back(static_cast<char>(0xef));
-            dest.push_back(static_cast<char>(0xbf));
-            dest.push_back(static_cast<char>(0xbd));
-        }
-        else if (cp < 128) {
-            dest.push_back(static_cast<char>(cp));
-        }
-        else if (cp < 2048) {
-            dest.push_back(
-                static_cast<char>(0xc0 | (static_cast<char>(u32cp >> 6))));
-            dest.push_back(
-                static_cast<char>(0x80 | (static_cast<char>(u32cp) & 0x3f)));
-        }
-        else if (cp < 65536) {
-            dest.push_back(
-                static_cast<char>(0xe0 | (static_cast<char>(u32cp >> 12))));
-            dest.push_back(static_cast<char>(
-                0x80 | (static_cast<char>(u32cp >> 6) & 0x3f)));
-            dest.push_back(
-                static_cast<char>(0x80 | (static_cast<char>(u32cp) & 0x3f)));
-        }
-        else {
-            dest.push_back(
-                static_cast<char>(0xf0 | (static_cast<char>(u32cp >> 18))));
-            dest.push_back(static_cast<char>(
-                0x80 | (static_cast<char>(u32cp >> 12) & 0x3f)));
-            dest.push_back(static_cast<char>(
-                0x80 | (static_cast<char>(u32cp >> 6) & 0x3f)));
-            dest.push_back(
-                static_cast<char>(0x80 | (static_cast<char>(u32cp) & 0x3f)));
+    const auto narrow_ascii =
+        get_kernel_dispatch_table().narrow_ascii_from_utf32;
+
+    // Sized for ASCII, and grown when non-ASCII is encountered:
+    // counting the output length up front would take another pass.
+    // There's always room for the rest of `src` as ASCII.
+    const auto start = dest.size();
+    dest.resize(start + src.size());
+    auto* out = dest.data() + start;
+    std::size_t i = 0;
+    while (i < src.size()) {
+        const auto n = narrow_ascii(src.data() + i, src.size() - i,
+                                    reinterpret_cast<char*>(out));
+        i += n;
+        out += n;
+
+        const auto scalar_end =
+            (std::min)(src.size(), i + transcode_kernel_block_size);
+        for (; i < scalar_end; ++i) {
+            auto cp = static_cast<char32_t>(src[i]);
+            if (SCN_UNLIKELY(!VerifiedValid &&
+                             cp >= detail::invalid_code_point)) {
+                cp = 0xfffd;
+            }
+
+            const auto rest = src.size() - i;
+            if (SCN_UNLIKELY(
+                    static_cast<std::size_t>(dest.data() + dest.size() - out) <
+                    rest + 3)) {
+                // At most four code units for this code point: leave
+                // room for twice the rest, so that this is done
+                // a logarithmic number of times at most
+                const auto pos = static_cast<std::size_t>(out - dest.data());
+                dest.resize(pos + 2 * rest + 3);
+                out = dest.data() + pos;
+            }
+            out = encode_code_point_as_utf8(cp, out);
         }
     }
+    dest.resize(static_cast<std::size_t>(out - dest.data()));
 }
 
 template <bool VerifiedValid, typename SourceCharT, typename DestCharT>
@@ -1463,21 +1739,25 @@ void transcode_to_string_impl_32to16(std::basic_string_view<SourceCharT> src,
     static_assert(sizeof(SourceCharT) == 4);
     static_assert(sizeof(DestCharT) == 2);
 
+    std::size_t length = src.size();
     for (auto cp : src) {
         const auto u32cp = static_cast<uint32_t>(cp);
-        if (SCN_UNLIKELY(!VerifiedValid && cp >= detail::invalid_code_point)) {
-            dest.push_back(char16_t{0xfffd});
-        }
-        else if (cp < 0x10000) {
-            dest.push_back(static_cast<char16_t>(cp));
-        }
-        else {
-            dest.push_back(
-                static_cast<char16_t>((u32cp - 0x10000) / 0x400 + 0xd800));
-            dest.push_back(
-                static_cast<char16_t>((u32cp - 0x10000) % 0x400 + 0xd800));
+        length += static_cast<std::size_t>(
+            u32cp >= 0x10000 &&
+            (VerifiedValid || u32cp < detail::invalid_code_point));
+    }
+
+    const auto start = dest.size();
+    dest.resize(start + length);
+    auto* out = dest.data() + start;
+    for (auto cp : src) {
+        auto c32 = static_cast<char32_t>(cp);
+        if (SCN_UNLIKELY(!VerifiedValid && c32 >= detail::invalid_code_point)) {
+            c32 = 0xfffd;
         }
+        out = encode_code_point_as_utf16_or_32(c32, out);
     }
+    SCN_ENSURE(out == dest.data() + dest.size());
 }
 
 template <typename SourceCharT, typename DestCharT>
@@ -1487,15 +1767,7 @@ void transcode_to_string(std::basic_string_view<SourceCharT> src,
     static_assert(sizeof(SourceCharT) != sizeof(DestCharT));
 
     if constexpr (sizeof(SourceCharT) == 1) {
-        if constexpr (sizeof(DestCharT) == 2) {
-            std::u32string tmp;
-            transcode_to_string_impl_to32(src, tmp);
-            return transcode_to_string_impl_32to16<false>(
-                std::u32string_view{tmp}, dest);
-        }
-        else if constexpr (sizeof(DestCharT) == 4) {
-            return transcode_to_string_impl_to32(src, dest);
-        }
+        return transcode_to_string_impl_8to16_or_32<false>(src, dest);
     }
     else if constexpr (sizeof(SourceCharT) == 2) {
         if constexpr (sizeof(DestCharT) == 1) {
@@ -1505,7 +1777,7 @@ void transcode_to_string(std::basic_string_view<SourceCharT> src,
                 std::u32string_view{tmp}, dest);
         }
         else if constexpr (sizeof(DestCharT) == 4) {
-            return trasncode_to_string_impl_to32(src, dest);
+            return transcode_to_string_impl_to32(src, dest);
         }
     }
     else if constexpr (sizeof(SourceCharT) == 4) {
@@ -1528,16 +1800,7 @@ void transcode_valid_to_string(std::basic_string_view<SourceCharT> src,
 
     SCN_EXPECT(validate_unicode(src));
     if constexpr (sizeof(SourceCharT) == 1) {
-        if constexpr (sizeof(DestCharT) == 2) {
-            // TODO: Optimize, remove utf32-step, go direct utf8->utf16
-            std::u32string tmp;
-            transcode_valid_to_string_impl_to32(src, tmp);
-            return transcode_to_string_impl_32to16<true>(
-                std::u32string_view{tmp}, dest);
-        }
-        else if constexpr (sizeof(DestCharT) == 4) {
-            return transcode_valid_to_string_impl_to32(src, dest);
-        }
+        return transcode_to_string_impl_8to16_or_32<true>(src, dest);
     }
     else if constexpr (sizeof(SourceCharT) == 2) {
         if constexpr (sizeof(DestCharT) == 1) {
@@ -1547,7 +1810,7 @@ void transcode_valid_to_string(std::basic_string_view<SourceCharT> src,
                 std::u32string_view{tmp}, dest);
         }
         else if constexpr (sizeof(DestCharT) == 4) {
-            return trasncode_valid_to_string_impl_to32(src, dest);
+            return transcode_valid_to_string_impl_to32(src, dest);
         }
     }
     else if constexpr (sizeof(SourceCharT) == 4) {
@@ -1877,13 +2140,22 @@ private:
 
 class set_clocale_classic_guard {
 public:
-    set_clocale_classic_guard(int cat) : m_restorer(cat)
+    set_clocale_classic_guard(int cat)
     {
+        // Setting the locale is global and slow:
+        // don't touch it at all, if it's already the classic one
+        const auto loc = std::setlocale(cat, nullptr);
+        if (loc != nullptr &&
+            (std::strcmp(loc, "C") == 0 || std::strcmp(loc, "POSIX") == 0)) {
+            return;
+        }
+
+        m_restorer.emplace(cat);
         std::setlocale(cat, "C");
     }
 
 private:
-    clocale_restorer m_restorer;
+    std::optional<clocale_restorer> m_restorer{};
 };
 }  // namespace impl
 
@@ -2461,31 +2733,85 @@ auto apply_opt(Expected<Iterator>&& result, Range range)
 // Text width calculation
 /////////////////////////////////////////////////////////////////
 
+struct code_point_range {
+    char32_t first;
+    char32_t last;
+};
+
+// Code points with a width of 2, sorted
+inline constexpr code_point_range double_width_code_points[] = {
+    {0x1100, 0x115f},    // Hangul Jamo init. consonants
+    {0x2329, 0x232a},    // LEFT- and RIGHT-POINTING ANGLE BRACKET
+    {0x2e80, 0x303e},    // CJK ... Yi except IDEOGRAPHIC HALF FILL SPACE
+    {0x3040, 0xa4cf},    //
+    {0xac00, 0xd7a3},    // Hangul Syllables
+    {0xf900, 0xfaff},    // CJK Compatibility Ideographs
+    {0xfe10, 0xfe19},    // Vertical Forms
+    {0xfe30, 0xfe6f},    // CJK Compatibility Forms
+    {0xff00, 0xff60},    // Fullwidth Forms
+    {0xffe0, 0xffe6},    //
+    {0x1f300, 0x1f64f},  // Miscellaneous Symbols and Pictographs + Emoticons
+    {0x1f900, 0x1f9ff},  // Supplemental Symbols and Pictographs
+    {0x20000, 0x2fffd},  // CJK
+    {0x30000, 0x3fffd},  //
+};
+
 constexpr std::size_t calculate_text_width_for_fmt_v10(char32_t cp)
 {
-    if (cp >= 0x1100 &&
-        (cp <= 0x115f ||  // Hangul Jamo init. consonants
-         cp == 0x2329 ||  // LEFT-POINTING ANGLE BRACKET
-         cp == 0x232a ||  // RIGHT-POINTING ANGLE BRACKET
-         // CJK ... Yi except IDEOGRAPHIC HALF FILL SPACE:
-         (cp >= 0x2e80 && cp <= 0xa4cf && cp != 0x303f) ||
-         (cp >= 0xac00 && cp <= 0xd7a3) ||    // Hangul Syllables
-         (cp >= 0xf900 && cp <= 0xfaff) ||    // CJK Compatibility Ideographs
-         (cp >= 0xfe10 && cp <= 0xfe19) ||    // Vertical Forms
-         (cp >= 0xfe30 && cp <= 0xfe6f) ||    // CJK Compatibility Forms
-         (cp >= 0xff00 && cp <= 0xff60) ||    // Fullwidth Forms
-         (cp >= 0xffe0 && cp <= 0xffe6) ||    // Fullwidth Forms
-         (cp >= 0x20000 && cp <= 0x2fffd) ||  // CJK
-         (cp >= 0x30000 && cp <= 0x3fffd) ||
-         // Miscellaneous Symbols and Pictographs + Emoticons:
-         (cp >= 0x1f300 && cp <= 0x1f64f) ||
-         // Supplemental Symbols and Pictographs:
-         (cp >= 0x1f900 && cp <= 0x1f9ff))) {
+    if (cp < double_width_code_points[0].first) {
+        return 1;
+    }
+
+    // Binary search for the first range not entirely before cp
+    std::size_t lo = 0, hi = std::size(double_width_code_points);
+    while (lo < hi) {
+        const auto mid = lo + (hi - lo) / 2;
+        if (double_width_code_points[mid].last < cp) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    if (lo != std::size(double_width_code_points) &&
+        double_width_code_points[lo].first <= cp) {
         return 2;
     }
     return 1;
 }
 
+// The width of every ASCII code unit is 1:
+// runs of them are skipped with the find_nonascii kernel,
+// and only the code points in between are decoded
+template <bool VerifiedValid>
+std::size_t calculate_narrow_text_width(std::string_view input)
+{
+    const auto find_nonascii = get_kernel_dispatch_table().find_nonascii;
+
+    std::size_t count{0};
+    std::size_t i = 0;
+    while (true) {
+        const auto ascii = find_nonascii(input.data() + i, input.size() - i);
+        count += ascii;
+        i += ascii;
+        if (i == input.size()) {
+            return count;
+        }
+
+        const auto res = [&]() {
+            if constexpr (VerifiedValid) {
+                return get_next_code_point_valid(input.substr(i));
+            }
+            else {
+                return get_next_code_point(input.substr(i));
+            }
+        }();
+        count += calculate_text_width_for_fmt_v10(res.value);
+        i = static_cast<std::size_t>(ranges::distance(
+            input.data(), detail::to_address(res.iterator)));
+    }
+}
+
 constexpr std::size_t calculate_valid_text_width(char32_t cp)
 {
     return calculate_text_width_for_fmt_v10(cp);
@@ -2494,11 +2820,16 @@ constexpr std::size_t calculate_valid_text_width(char32_t cp)
 template <typename CharT>
 std::size_t calculate_valid_text_width(std::basic_string_view<CharT> input)
 {
-    size_t count{0};
-    for_each_code_point_valid(input, [&count](char32_t cp) {
-        count += calculate_text_width_for_fmt_v10(cp);
-    });
-    return count;
+    if constexpr (std::is_same_v<CharT, char>) {
+        return calculate_narrow_text_width<true>(input);
+    }
+    else {
+        size_t count{0};
+        for_each_code_point_valid(input, [&count](char32_t cp) {
+            count += calculate_text_width_for_fmt_v10(cp);
+        });
+        return count;
+    }
 }
 
 constexpr std::size_t calculate_text_width(char32_t cp)
@@ -2509,11 +2840,16 @@ constexpr std::size_t calculate_text_width(char32_t cp)
 template <typename CharT>
 std::size_t calculate_text_width(std::basic_string_view<CharT> input)
 {
-    size_t count{0};
-    for_each_code_point(input, [&count](char32_t cp) {
-        count += calculate_text_width_for_fmt_v10(cp);
-    });
-    return count;
+    if constexpr (std::is_same_v<CharT, char>) {
+        return calculate_narrow_text_width<false>(input);
+    }
+    else {
+        size_t count{0};
+        for_each_code_point(input, [&count](char32_t cp) {
+            count += calculate_text_width_for_fmt_v10(cp);
+        });
+        return count;
+    }
 }
 
 namespace counted_width_iterator_impl {
@@ -4459,6 +4795,162 @@ inline auto make_regex_flags(detail::regex_flags flags)
 }
 #endif  // SCN_REGEX_BACKEND == ...
 
+#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
+template <typename CharT>
+using regex_type = std::basic_regex<CharT>;
+#elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_BOOST
+#if SCN_REGEX_BOOST_USE_ICU
+template <typename CharT>
+using regex_type = boost::u32regex;
+#else
+template <typename CharT>
+using regex_type = boost::basic_regex<CharT>;
+#endif
+#elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_RE2
+template <typename CharT>
+using regex_type = re2::RE2;
+#endif  // SCN_REGEX_BACKEND == ...
+
+// Compile `pattern` with the regex backend.
+// If `nosubs`, subexpressions aren't captured.
+template <typename CharT>
+auto compile_regex(std::basic_string_view<CharT> pattern,
+                   detail::regex_flags flags,
+                   bool nosubs)
+    -> scan_expected<std::unique_ptr<regex_type<CharT>>>
+{
+#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
+    try {
+        SCN_TRY(re_flags, make_regex_flags(flags));
+        if (nosubs) {
+            re_flags |= std::regex_constants::nosubs;
+        }
+        return std::make_unique<std::basic_regex<CharT>>(
+            pattern.data(), pattern.size(), re_flags);
+    }
+    catch (const std::regex_error&) {
+        return detail::unexpected_scan_error(scan_error::invalid_format_string,
+                                             "Invalid regex");
+    }
+#elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_BOOST
+    auto re_flags =
+        make_regex_flags(flags) | boost::regex_constants::no_except;
+    if (nosubs) {
+        re_flags |= boost::regex_constants::nosubs;
+    }
+    auto re = std::make_unique<regex_type<CharT>>(
+#if SCN_REGEX_BOOST_USE_ICU
+        boost::make_u32regex(pattern.data(), pattern.data() + pattern.size(),
+                             re_flags)
+#else
+        pattern.data(), pattern.size(), re_flags
+#endif
+    );
+    if (re->status() != 0) {
+        return detail::unexpected_scan_error(scan_error::invalid_format_string,
+                                             "Invalid regex");
+    }
+    return re;
+#elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_RE2
+    static_assert(std::is_same_v<CharT, char>);
+    auto [opts, flagstr] = make_regex_flags(flags);
+    if (nosubs) {
+        opts.set_never_capture(true);
+    }
+    auto re = [&]() {
+        if (flagstr.empty()) {
+            return std::make_unique<re2::RE2>(pattern, opts);
+        }
+        std::string flagged_pattern{};
+        flagged_pattern.reserve(flagstr.size() + pattern.size());
+        flagged_pattern.append(flagstr);
+        flagged_pattern.append(pattern);
+        return std::make_unique<re2::RE2>(flagged_pattern, opts);
+    }();
+    if (!re->ok()) {
+        return detail::unexpected_scan_error(
+            scan_error::invalid_format_string,
+            "Failed to parse regular expression");
+    }
+    return re;
+#endif  // SCN_REGEX_BACKEND == ...
+}
+
+#ifndef SCN_REGEX_CACHE_SIZE
+#define SCN_REGEX_CACHE_SIZE 16
+#endif
+
+inline regex_cache_stats& regex_cache_thread_stats()
+{
+    thread_local regex_cache_stats stats{};
+    return stats;
+}
+
+// Least-recently-used cache of compiled regexes, keyed by the pattern and
+// the flags. One per thread, see `get_thread_local()`, so no locking.
+template <typename CharT, bool Nosubs>
+class regex_cache {
+public:
+    static constexpr std::size_t capacity = SCN_REGEX_CACHE_SIZE;
+    static_assert(capacity > 0, "SCN_REGEX_CACHE_SIZE must be positive");
+
+    using regex_type = impl::regex_type<CharT>;
+
+    static regex_cache& get_thread_local()
+    {
+        thread_local regex_cache cache{};
+        return cache;
+    }
+
+    // The returned regex stays valid until the next call
+    auto get_or_compile(std::basic_string_view<CharT> pattern,
+                        detail::regex_flags flags)
+        -> scan_expected<const regex_type*>
+    {
+        auto& stats = regex_cache_thread_stats();
+        ++m_clock;
+
+        for (auto& entry : m_entries) {
+            if (entry.flags == flags && entry.pattern == pattern) {
+                ++stats.hits;
+                entry.last_used = m_clock;
+                return entry.regex.get();
+            }
+        }
+
+        ++stats.misses;
+        SCN_TRY(regex, compile_regex(pattern, flags, Nosubs));
+
+        entry_type* entry{};
+        if (m_entries.size() < capacity) {
+            entry = &m_entries.emplace_back();
+        }
+        else {
+            entry = &*std::min_element(
+                m_entries.begin(), m_entries.end(),
+                [](const entry_type& a, const entry_type& b) {
+                    return a.last_used < b.last_used;
+                });
+        }
+        entry->pattern.assign(pattern.data(), pattern.size());
+        entry->flags = flags;
+        entry->last_used = m_clock;
+        entry->regex = SCN_MOVE(regex);
+        return entry->regex.get();
+    }
+
+private:
+    struct entry_type {
+        std::basic_string<CharT> pattern{};
+        detail::regex_flags flags{detail::regex_flags::none};
+        std::uint64_t last_used{0};
+        std::unique_ptr<regex_type> regex{};
+    };
+
+    std::vector<entry_type> m_entries{};
+    std::uint64_t m_clock{0};
+};
+
 template <typename CharT, typename Input>
 auto read_regex_string_impl(std::basic_string_view<CharT> pattern,
                             detail::regex_flags flags,
@@ -4469,19 +4961,13 @@ auto read_regex_string_impl(std::basic_string_view<CharT> pattern,
                   ranges::borrowed_range<Input> &&
                   std::is_same_v<ranges::range_value_t<Input>, CharT>);
 
-#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
-    std::basic_regex<CharT> re{};
-    try {
-        SCN_TRY(re_flags, make_regex_flags(flags));
-        re = std::basic_regex<CharT>{pattern.data(), pattern.size(),
-                                     re_flags | std::regex_constants::nosubs};
-    }
-    catch (const std::regex_error&) {
-        return detail::unexpected_scan_error(scan_error::invalid_format_string,
-                                             "Invalid regex");
-    }
+    SCN_TRY(cached_re, (regex_cache<CharT, true>::get_thread_local()
+                            .get_or_compile(pattern, flags)));
+    const auto& re = *cached_re;
 
-    std::match_results<const CharT*> matches{};
+#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
+    // Reused, to keep its storage between reads
+    thread_local std::match_results<const CharT*> matches{};
     try {
         bool found = std::regex_search(input.data(),
                                        input.data() + input.size(), matches, re,
@@ -4500,24 +4986,8 @@ auto read_regex_string_impl(std::basic_string_view<CharT> pattern,
 
     return input.begin() + ranges::distance(input.data(), matches[0].second);
 #elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_BOOST
-    auto re =
-#if SCN_REGEX_BOOST_USE_ICU
-        boost::make_u32regex(pattern.data(), pattern.data() + pattern.size(),
-                             make_regex_flags(flags) |
-                                 boost::regex_constants::no_except |
-                                 boost::regex_constants::nosubs);
-#else
-        boost::basic_regex<CharT>{pattern.data(), pattern.size(),
-                                  make_regex_flags(flags) |
-                                      boost::regex_constants::no_except |
-                                      boost::regex_constants::nosubs};
-#endif
-    if (re.status() != 0) {
-        return detail::unexpected_scan_error(scan_error::invalid_format_string,
-                                             "Invalid regex");
-    }
-
-    boost::match_results<const CharT*> matches{};
+    // Reused, to keep its storage between reads
+    thread_local boost::match_results<const CharT*> matches{};
     try {
         bool found =
 #if SCN_REGEX_BOOST_USE_ICU
@@ -4543,25 +5013,6 @@ auto read_regex_string_impl(std::basic_string_view<CharT> pattern,
 
     return input.begin() + ranges::distance(input.data(), matches[0].second);
 #elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_RE2
-    static_assert(std::is_same_v<CharT, char>);
-    std::string flagged_pattern{};
-    auto re = [&]() {
-        auto [opts, flagstr] = make_regex_flags(flags);
-        opts.set_never_capture(true);
-        if (flagstr.empty()) {
-            return re2::RE2{pattern, opts};
-        }
-        flagged_pattern.reserve(flagstr.size() + pattern.size());
-        flagged_pattern.append(flagstr);
-        flagged_pattern.append(pattern);
-        return re2::RE2{flagged_pattern, opts};
-    }();
-    if (!re.ok()) {
-        return detail::unexpected_scan_error(
-            scan_error::invalid_format_string,
-            "Failed to parse regular expression");
-    }
-
     auto new_input = detail::make_string_view_from_pointers(
         detail::to_address(input.begin()), detail::to_address(input.end()));
     bool found = re2::RE2::Consume(&new_input, re);
@@ -4573,29 +5024,54 @@ auto read_regex_string_impl(std::basic_string_view<CharT> pattern,
 #endif  // SCN_REGEX_BACKEND == ...
 }
 
-template <typename CharT, typename Input>
+// Makes room for `n` matches in `value`,
+// and returns a pointer to the first one
+template <typename CharT>
+auto prepare_regex_matches_output(basic_regex_matches<CharT>& value,
+                                  std::size_t n)
+    -> scan_expected<std::optional<basic_regex_match<CharT>>*>
+{
+    value.resize(n);
+    return value.data();
+}
+template <typename CharT>
+auto prepare_regex_matches_output(detail::regex_matches_storage<CharT>& value,
+                                  std::size_t n)
+    -> scan_expected<std::optional<basic_regex_match<CharT>>*>
+{
+    if (n > value.capacity) {
+        return detail::unexpected_scan_error(
+            scan_error::invalid_format_string,
+            "Regex has more subexpressions than fit in static_regex_matches");
+    }
+    value.size = n;
+    return value.data;
+}
+
+// Names of captures are only stored into a `basic_regex_matches`:
+// a `regex_matches_storage` doesn't allocate
+template <typename Matches>
+inline constexpr bool regex_matches_output_has_names =
+    !detail::is_specialization_of_v<Matches, detail::regex_matches_storage>;
+
+template <typename CharT, typename Input, typename Matches>
 auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
                              detail::regex_flags flags,
                              Input input,
-                             basic_regex_matches<CharT>& value)
+                             Matches& value)
     -> scan_expected<ranges::iterator_t<Input>>
 {
     static_assert(ranges::contiguous_range<Input> &&
                   ranges::borrowed_range<Input> &&
                   std::is_same_v<ranges::range_value_t<Input>, CharT>);
 
-#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
-    std::basic_regex<CharT> re{};
-    try {
-        SCN_TRY(re_flags, make_regex_flags(flags));
-        re = std::basic_regex<CharT>{pattern.data(), pattern.size(), re_flags};
-    }
-    catch (const std::regex_error&) {
-        return detail::unexpected_scan_error(scan_error::invalid_format_string,
-                                             "Invalid regex");
-    }
+    SCN_TRY(cached_re, (regex_cache<CharT, false>::get_thread_local()
+                            .get_or_compile(pattern, flags)));
+    const auto& re = *cached_re;
 
-    std::match_results<const CharT*> matches{};
+#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
+    // Reused, to keep its storage between reads
+    thread_local std::match_results<const CharT*> matches{};
     try {
         bool found = std::regex_search(input.data(),
                                        input.data() + input.size(), matches, re,
@@ -4612,8 +5088,8 @@ auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
             "Regex matching failed with an error");
     }
 
-    value.resize(matches.size());
-    std::transform(matches.begin(), matches.end(), value.begin(),
+    SCN_TRY(out, prepare_regex_matches_output(value, matches.size()));
+    std::transform(matches.begin(), matches.end(), out,
                    [](auto&& match) -> std::optional<basic_regex_match<CharT>> {
                        if (!match.matched)
                            return std::nullopt;
@@ -4623,7 +5099,8 @@ auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
     return input.begin() + ranges::distance(input.data(), matches[0].second);
 #elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_BOOST
     std::vector<std::basic_string<CharT>> names;
-    for (size_t i = 0; i < pattern.size();) {
+    for (size_t i = 0; regex_matches_output_has_names<Matches> &&
+                       i < pattern.size();) {
         if constexpr (std::is_same_v<CharT, char>) {
             i = pattern.find("(?<", i);
         }
@@ -4649,22 +5126,8 @@ auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
         names.emplace_back(pattern.substr(i, end_i - i));
     }
 
-    auto re =
-#if SCN_REGEX_BOOST_USE_ICU
-        boost::make_u32regex(
-            pattern.data(), pattern.data() + pattern.size(),
-            make_regex_flags(flags) | boost::regex_constants::no_except);
-#else
-        boost::basic_regex<CharT>{
-            pattern.data(), pattern.size(),
-            make_regex_flags(flags) | boost::regex_constants::no_except};
-#endif
-    if (re.status() != 0) {
-        return detail::unexpected_scan_error(scan_error::invalid_format_string,
-                                             "Invalid regex");
-    }
-
-    boost::match_results<const CharT*> matches{};
+    // Reused, to keep its storage between reads
+    thread_local boost::match_results<const CharT*> matches{};
     try {
         bool found =
 #if SCN_REGEX_BOOST_USE_ICU
@@ -4688,9 +5151,9 @@ auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
             "Regex matching failed with an error");
     }
 
-    value.resize(matches.size());
+    SCN_TRY(out, prepare_regex_matches_output(value, matches.size()));
     std::transform(
-        matches.begin(), matches.end(), value.begin(),
+        matches.begin(), matches.end(), out,
         [&](auto&& match) -> std::optional<basic_regex_match<CharT>> {
             if (!match.matched)
                 return std::nullopt;
@@ -4707,29 +5170,15 @@ auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
         });
     return input.begin() + ranges::distance(input.data(), matches[0].second);
 #elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_RE2
-    static_assert(std::is_same_v<CharT, char>);
-    std::string flagged_pattern{};
-    auto re = [&]() {
-        auto [opts, flagstr] = make_regex_flags(flags);
-        if (flagstr.empty()) {
-            return re2::RE2{pattern, opts};
-        }
-        flagged_pattern.reserve(flagstr.size() + pattern.size());
-        flagged_pattern.append(flagstr);
-        flagged_pattern.append(pattern);
-        return re2::RE2{flagged_pattern, opts};
-    }();
-    if (!re.ok()) {
-        return detail::unexpected_scan_error(
-            scan_error::invalid_format_string,
-            "Failed to parse regular expression");
-    }
-    // TODO: Optimize into a single batch allocation
+    // Reused, to keep their storage between reads
+    thread_local std::vector<std::optional<std::string_view>> matches{};
+    thread_local std::vector<re2::RE2::Arg> match_args{};
+    thread_local std::vector<re2::RE2::Arg*> match_argptrs{};
     const auto max_matches_n =
         static_cast<size_t>(re.NumberOfCapturingGroups());
-    std::vector<std::optional<std::string_view>> matches(max_matches_n);
-    std::vector<re2::RE2::Arg> match_args(max_matches_n);
-    std::vector<re2::RE2::Arg*> match_argptrs(max_matches_n);
+    matches.assign(max_matches_n, std::nullopt);
+    match_args.resize(max_matches_n);
+    match_argptrs.resize(max_matches_n);
     std::transform(matches.begin(), matches.end(), match_args.begin(),
                    [](auto& val) { return re2::RE2::Arg{&val}; });
     std::transform(match_args.begin(), match_args.end(), match_argptrs.begin(),
@@ -4742,22 +5191,25 @@ auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
         return detail::unexpected_scan_error(scan_error::invalid_scanned_value,
                                              "Regular expression didn't match");
     }
-    value.resize(matches.size() + 1);
-    value[0] =
+    SCN_TRY(out, prepare_regex_matches_output(value, matches.size() + 1));
+    out[0] =
         detail::make_string_view_from_pointers(input.data(), new_input.data());
-    std::transform(matches.begin(), matches.end(), value.begin() + 1,
+    std::transform(matches.begin(), matches.end(), out + 1,
                    [&](auto&& match) -> std::optional<regex_match> {
                        if (!match)
                            return std::nullopt;
                        return *match;
                    });
-    {
+    if constexpr (regex_matches_output_has_names<Matches>) {
         const auto& capturing_groups = re.CapturingGroupNames();
-        for (size_t i = 1; i < value.size(); ++i) {
+        for (size_t i = 1; i < matches.size() + 1; ++i) {
+            if (!out[i]) {
+                continue;
+            }
             if (auto it = capturing_groups.find(static_cast<int>(i));
                 it != capturing_groups.end()) {
-                auto val = value[i]->get();
-                value[i].emplace(val, it->second);
+                auto val = out[i]->get();
+                out[i].emplace(val, it->second);
             };
         }
     }
@@ -4807,12 +5259,24 @@ struct regex_matches_reader
     }
 
     template <typename Range, typename DestCharT>
+    auto read_default(Range,
+                      detail::regex_matches_storage<DestCharT>&,
+                      detail::locale_ref = {})
+        -> scan_expected<ranges::const_iterator_t<Range>>
+    {
+        return detail::unexpected_scan_error(
+            scan_error::invalid_format_string,
+            "No regex given in format string for scanning regex_matches");
+    }
+
+    template <typename Range, typename Matches>
     auto read_specs(Range range,
                     const detail::format_specs& specs,
-                    basic_regex_matches<DestCharT>& value,
+                    Matches& value,
                     detail::locale_ref = {})
         -> scan_expected<ranges::const_iterator_t<Range>>
     {
+        using DestCharT = typename Matches::char_type;
         SCN_UNUSED(range);
         if constexpr (!std::is_same_v<SourceCharT, DestCharT>) {
             return detail::unexpected_scan_error(
@@ -4845,15 +5309,14 @@ struct regex_matches_reader
     }
 
 private:
-    template <typename Range, typename DestCharT>
+    template <typename Range, typename Matches>
     auto impl(Range input,
               bool is_escaped,
               std::basic_string_view<SourceCharT> pattern,
               detail::regex_flags flags,
-              basic_regex_matches<DestCharT>& value)
+              Matches& value)
     {
-        if constexpr (detail::is_type_disabled<
-                          basic_regex_matches<DestCharT>>) {
+        if constexpr (detail::is_type_disabled<Matches>) {
             SCN_EXPECT(false);
             SCN_UNREACHABLE;
         }
@@ -4876,6 +5339,70 @@ struct reader_impl_for_regex_matches : public regex_matches_reader<CharT> {};
 // String reader
 /////////////////////////////////////////////////////////////////
 
+// Validates `token`, the characters at [first, first + token.size())
+// in `buffer`, using and updating the validated range cached in it.
+// On a miss, the rest of the line is validated in the same pass,
+// so that later fields on it don't need to be validated again.
+template <typename CharT>
+bool validate_unicode_in_scan_buffer(detail::basic_scan_buffer<CharT>& buffer,
+                                     std::ptrdiff_t first,
+                                     std::basic_string_view<CharT> token)
+{
+    const auto last = first + static_cast<std::ptrdiff_t>(token.size());
+    const auto [validated_first, validated_last] =
+        buffer.validated_encoding_range();
+    if (first >= validated_first && last <= validated_last) {
+        return true;
+    }
+
+    // A line break is always at a code point boundary,
+    // unlike the end of the buffered segment
+    const auto segment = buffer.get_segment_starting_at(first);
+    if (token.size() <= segment.size()) {
+        const auto line_end = segment.find(CharT{'\n'}, token.size());
+        if (line_end != std::basic_string_view<CharT>::npos &&
+            validate_unicode(segment.substr(0, line_end + 1))) {
+            buffer.set_validated_encoding_range(
+                first, first + static_cast<std::ptrdiff_t>(line_end + 1));
+            return true;
+        }
+    }
+
+    if (!validate_unicode(token)) {
+        return false;
+    }
+    buffer.set_validated_encoding_range(first, last);
+    return true;
+}
+
+// Validates `token`, read from the beginning of `range`
+template <typename Range, typename CharT>
+bool validate_scanned_unicode(Range& range,
+                              std::basic_string_view<CharT> token)
+{
+    if (assume_valid_encoding_scope::is_active()) {
+        return true;
+    }
+
+    auto it = [&]() {
+        if constexpr (detail::is_specialization_of_v<Range, take_width_view>) {
+            return range.begin().base();
+        }
+        else {
+            return range.begin();
+        }
+    }();
+    if constexpr (std::is_same_v<
+                      decltype(it),
+                      typename detail::basic_scan_buffer<CharT>::forward_iterator>) {
+        if (it.stores_parent()) {
+            return validate_unicode_in_scan_buffer(*it.parent(), it.position(),
+                                                   token);
+        }
+    }
+    return validate_unicode(token);
+}
+
 template <typename Range, typename Iterator, typename ValueCharT>
 auto read_string_impl(Range range,
                       Iterator&& result,
@@ -4885,7 +5412,7 @@ auto read_string_impl(Range range,
     static_assert(ranges::forward_iterator<detail::remove_cvref_t<Iterator>>);
 
     auto src = make_contiguous_buffer(ranges::subrange{range.begin(), result});
-    if (!validate_unicode(src.view())) {
+    if (!validate_scanned_unicode(range, src.view())) {
         return detail::unexpected_scan_error(
             scan_error::invalid_scanned_value,
             "Invalid encoding in scanned string");
@@ -4931,7 +5458,7 @@ auto read_string_view_impl(Range range,
         const auto view = src.view();
         value = std::basic_string_view<ValueCharT>(view.data(), view.size());
 
-        if (!validate_unicode(value)) {
+        if (!validate_scanned_unicode(range, value)) {
             return detail::unexpected_scan_error(
                 scan_error::invalid_scanned_value,
                 "Invalid encoding in scanned string_view");
@@ -5123,19 +5650,8 @@ struct nonascii_specs_handler {
             return;
         }
 
-        for (auto& elem : extra_ranges) {
-            // TODO: check for overlap
-            if (elem.first == end) {
-                elem.first = begin;
-                return;
-            }
-
-            if (elem.second == begin) {
-                elem.second = end;
-                return;
-            }
-        }
-
+        // Merged with overlapping neighbors after parsing,
+        // see parse_charset_nonascii_ranges
         extra_ranges.push_back(std::make_pair(begin, end));
     }
 
@@ -5163,6 +5679,35 @@ struct nonascii_specs_handler {
     scan_expected<void> err;
 };
 
+template <typename CharT>
+scan_expected<void> parse_charset_nonascii_ranges(
+    std::basic_string_view<CharT> charset_string,
+    nonascii_specs_handler& handler)
+{
+    auto it = detail::to_address(charset_string.begin());
+    auto set = detail::parse_presentation_set(
+        it, detail::to_address(charset_string.end()), handler);
+    SCN_TRY_DISCARD(handler.get_error());
+    SCN_ENSURE(it == detail::to_address(charset_string.end()));
+    SCN_ENSURE(set == charset_string);
+
+    // Sort, and merge overlapping and adjacent ranges,
+    // so that the result can be binary searched
+    auto& ranges = handler.extra_ranges;
+    std::sort(ranges.begin(), ranges.end());
+    auto out = ranges.begin();
+    for (const auto& range : ranges) {
+        if (out != ranges.begin() && range.first <= std::prev(out)->second) {
+            std::prev(out)->second = (std::max)(std::prev(out)->second,
+                                                range.second);
+            continue;
+        }
+        *out++ = range;
+    }
+    ranges.erase(out, ranges.end());
+    return {};
+}
+
 template <typename SourceCharT>
 class character_set_reader_impl {
 public:
@@ -5210,19 +5755,11 @@ private:
 
         bool is_char_set_in_extra_literals(char32_t cp) const
         {
-            // TODO: binary search?
-            if (nonascii.extra_ranges.empty()) {
-                return false;
+            if (extra_lookup) {
+                return extra_lookup->contains(cp);
             }
-
-            const auto cp_val = static_cast<uint32_t>(cp);
-            return std::find_if(
-                       nonascii.extra_ranges.begin(),
-                       nonascii.extra_ranges.end(),
-                       [cp_val](const auto& pair) noexcept {
-                           return static_cast<uint32_t>(pair.first) <= cp_val &&
-                                  static_cast<uint32_t>(pair.second) > cp_val;
-                       }) != nonascii.extra_ranges.end();
+            return detail::charset_nonascii_lookup::ranges_contain(
+                extra_ranges, extra_ranges_size, cp);
         }
 
         scan_expected<void> handle_nonascii()
@@ -5231,21 +5768,30 @@ private:
                 return {};
             }
 
-            auto charset_string = specs.charset_string<SourceCharT>();
-            auto it = detail::to_address(charset_string.begin());
-            auto set = detail::parse_presentation_set(
-                it, detail::to_address(charset_string.end()), nonascii);
-            SCN_TRY_DISCARD(nonascii.get_error());
-            SCN_ENSURE(it == detail::to_address(charset_string.end()));
-            SCN_ENSURE(set == charset_string);
+            if (specs.charset_lookup) {
+                // Already built by prepare_format
+                extra_lookup = specs.charset_lookup;
+                return {};
+            }
+
+            if (specs.charset_nonascii_ranges) {
+                extra_ranges = specs.charset_nonascii_ranges;
+                extra_ranges_size = specs.charset_nonascii_ranges_size;
+                return {};
+            }
 
-            std::sort(nonascii.extra_ranges.begin(),
-                      nonascii.extra_ranges.end());
+            SCN_TRY_DISCARD(parse_charset_nonascii_ranges(
+                specs.charset_string<SourceCharT>(), nonascii));
+            extra_ranges = nonascii.extra_ranges.data();
+            extra_ranges_size = nonascii.extra_ranges.size();
             return {};
         }
 
         const detail::format_specs& specs;
         nonascii_specs_handler nonascii;
+        const detail::charset_nonascii_lookup* extra_lookup{nullptr};
+        const std::pair<char32_t, char32_t>* extra_ranges{nullptr};
+        std::size_t extra_ranges_size{0};
     };
 
     struct read_source_callback {
@@ -5955,7 +6501,10 @@ constexpr auto make_reader()
     }
 #if !SCN_DISABLE_REGEX
     else if constexpr (std::is_same_v<T, regex_matches> ||
-                       std::is_same_v<T, wregex_matches>) {
+                       std::is_same_v<T, wregex_matches> ||
+                       std::is_same_v<T, detail::regex_matches_storage<char>> ||
+                       std::is_same_v<T,
+                                      detail::regex_matches_storage<wchar_t>>) {
         return reader_impl_for_regex_matches<CharT>{};
     }
 #endif
@@ -6254,6 +6803,41 @@ struct arg_reader {
         return result_type{rng.begin(), 0};
     }
 
+    // Returns the end of the value, and its width
+    template <typename Reader, typename Range, typename T>
+    auto impl_value_with_precision(Reader& rd,
+                                   Range rng,
+                                   std::ptrdiff_t max_width,
+                                   T& value)
+        -> scan_expected<skip_fill_result<ranges::iterator_t<Range>>>
+    {
+        using result_type = skip_fill_result<ranges::iterator_t<Range>>;
+
+        if constexpr (std::is_same_v<
+                          Range, ranges::subrange<const char*, const char*>>) {
+            // If every code unit within max_width is ASCII,
+            // the width is the number of code units:
+            // no need to count it one code point at a time.
+            // {:c} needs a take_width_view to know where to stop.
+            const auto n = (std::min)(max_width,
+                                      ranges::distance(rng.begin(), rng.end()));
+            if (specs.type != detail::presentation_type::character &&
+                get_kernel_dispatch_table().find_nonascii(
+                    rng.begin(), static_cast<std::size_t>(n)) ==
+                    static_cast<std::size_t>(n)) {
+                SCN_TRY(it,
+                        rd.read_specs(
+                            ranges::subrange{rng.begin(), rng.begin() + n},
+                            specs, value, loc));
+                return result_type{it, ranges::distance(rng.begin(), it)};
+            }
+        }
+
+        auto max_width_view = take_width(rng, max_width);
+        SCN_TRY(w_it, rd.read_specs(max_width_view, specs, value, loc));
+        return result_type{w_it.base(), max_width - w_it.count()};
+    }
+
     template <typename Reader, typename Range, typename T>
     auto impl(Reader& rd, Range rng, T& value)
         -> scan_expected<ranges::iterator_t<Range>>
@@ -6288,11 +6872,11 @@ struct arg_reader {
             }
 
             const auto initial_width = specs.precision - prefix_width;
-            auto max_width_view =
-                take_width(ranges::subrange{it, rng.end()}, initial_width);
-            SCN_TRY(w_it, rd.read_specs(max_width_view, specs, value, loc));
-            it = w_it.base();
-            value_width = initial_width - w_it.count();
+            SCN_TRY(value_result,
+                    impl_value_with_precision(
+                        rd, ranges::subrange{it, rng.end()}, initial_width,
+                        value));
+            std::tie(it, value_width) = value_result;
         }
         else {
             SCN_TRY_ASSIGN(it, rd.read_specs(ranges::subrange{it, rng.end()},
@@ -32,6 +32,9 @@ module;
 
 #include <scn/chrono.h>
 #include <scn/istream.h>
+#include <scn/parallel.h>
+#include <scn/prepared.h>
+#include <scn/push.h>
 #include <scn/ranges.h>
 #include <scn/regex.h>
 #include <scn/scan.h>
@@ -116,11 +119,19 @@ using scn::operator==;
 using scn::operator!=;
 using scn::scan_expected;
 using scn::scan_format_string_error;
+using scn::scan_sequence_error;
 
 using scn::file_marker_found;
 using scn::insufficient_range;
 using scn::invalid_char_type;
 using scn::invalid_input_range;
+using scn::mapped_file;
+#if SCN_POSIX
+using scn::fd_scan_buffer;
+using scn::make_fd_scan_buffer;
+#endif
+using scn::valid_utf8_view;
+using scn::assume_valid_utf8;
 
 using scn::basic_scan_arg;
 using scn::basic_scan_args;
@@ -132,6 +143,7 @@ using scn::basic_scan_parse_context;
 using scn::scan_result;
 
 using scn::basic_scan_format_string;
+using scn::compiled_format;
 using scn::runtime_format;
 
 using scn::basic_scan_context;
@@ -149,9 +161,12 @@ using scn::input;
 using scn::make_scan_result;
 using scn::prompt;
 using scn::scan;
+using scn::scan_floats;
 using scn::scan_int;
 using scn::scan_int_exhaustive_valid;
+using scn::scan_ints;
 using scn::scan_result_type;
+using scn::scan_sequence_result_type;
 using scn::scan_value;
 
 // chrono.h
@@ -187,8 +202,24 @@ using scn::October;
 using scn::September;
 
 using scn::datetime_components;
+using scn::timestamp_scanner;
 using scn::tm_with_tz;
 
+// parallel.h
+
+using scn::parallel_scan_lines;
+using scn::parallel_scan_options;
+using scn::scan_executor;
+
+// prepared.h
+
+using scn::prepare_format;
+using scn::prepared_format;
+
+// push.h
+
+using scn::push_scanner;
+
 // ranges.h
 
 using scn::range_format;
@@ -199,6 +230,9 @@ using scn::range_scanner;
 
 using scn::basic_regex_match;
 using scn::basic_regex_matches;
+using scn::basic_static_regex_matches;
+using scn::get_regex_cache_stats;
+using scn::regex_cache_stats;
 
 SCN_END_NAMESPACE
 }  // namespace scn
@@ -630,6 +630,14 @@ TEST(CustomPrecisionTest, DoubleWidthEmoji)
     EXPECT_STREQ(r->begin(), "a");
 }
 
+TEST(CustomPrecisionTest, AsciiPrefixBeforeDoubleWidth)
+{
+    auto r = scn::scan<std::string>("abcdefghi😂", "{:.10}");
+    ASSERT_TRUE(r);
+    EXPECT_EQ(r->value(), "abcdefghi");
+    EXPECT_STREQ(r->begin(), "😂");
+}
+
 TEST(CustomPrecisionTest, Fuzz1)
 {
     auto r = scn::scan<std::string>("a😂", "{:^.2}");
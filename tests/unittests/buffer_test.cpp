@@ -21,6 +21,14 @@
 
 #include <deque>
 
+#if SCN_POSIX
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
 using namespace std::string_view_literals;
 
 namespace {
@@ -101,3 +109,202 @@ TEST(ScanBufferTest, Deque2)
               "b");
     EXPECT_EQ(collect(scn::ranges::subrange{cached_it, it}), "bc");
 }
+
+TEST(ScanBufferTest, DequeSpanningChunks)
+{
+    auto src = std::string{};
+    for (int i = 0; i < 100; ++i) {
+        src += std::to_string(i);
+        src += ' ';
+    }
+    auto deque = std::deque<char>{};
+    std::copy(src.begin(), src.end(), std::back_inserter(deque));
+
+    auto buf = scn::detail::make_forward_scan_buffer(deque);
+    static_assert(decltype(buf)::chunk_size > 1);
+
+    EXPECT_EQ(collect(buf.get()), src);
+    EXPECT_EQ(buf.chars_available(), static_cast<std::ptrdiff_t>(src.size()));
+
+    auto it = std::next(buf.get().begin(), 190);
+    EXPECT_EQ(collect(scn::ranges::subrange{it, std::next(it, 5)}),
+              src.substr(190, 5));
+}
+
+TEST(ScanBufferTest, DequeUnchunked)
+{
+    auto src = "foo bar"sv;
+    auto deque = std::deque<char>{};
+    std::copy(src.begin(), src.end(), std::back_inserter(deque));
+
+    auto buf = scn::detail::basic_scan_forward_buffer_impl<std::deque<char>, 1>(
+        deque);
+
+    EXPECT_TRUE(buf.fill());
+    EXPECT_EQ(buf.chars_available(), 1);
+    EXPECT_EQ(collect(buf.get()), "foo bar");
+}
+
+#if SCN_POSIX
+
+namespace {
+struct socket_pair {
+    socket_pair()
+    {
+        int fds[2]{};
+        if (::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0) {
+            reader = fds[0];
+            writer = fds[1];
+        }
+    }
+    ~socket_pair()
+    {
+        close_reader();
+        close_writer();
+    }
+
+    void write(std::string_view data)
+    {
+        ASSERT_EQ(::write(writer, data.data(), data.size()),
+                  static_cast<ssize_t>(data.size()));
+    }
+
+    void close_reader()
+    {
+        if (reader != -1) {
+            ::close(reader);
+            reader = -1;
+        }
+    }
+    void close_writer()
+    {
+        if (writer != -1) {
+            ::close(writer);
+            writer = -1;
+        }
+    }
+
+    int reader{-1};
+    int writer{-1};
+};
+}  // namespace
+
+TEST(ScanBufferTest, FileDescriptor)
+{
+    auto sockets = socket_pair{};
+    ASSERT_NE(sockets.reader, -1);
+    sockets.write("foobar");
+    sockets.close_writer();
+
+    auto buf = scn::make_fd_scan_buffer(sockets.reader);
+    EXPECT_FALSE(buf.is_contiguous());
+    EXPECT_EQ(collect(buf.get()), "foobar");
+    EXPECT_EQ(buf.chars_available(), 6);
+}
+
+TEST(ScanBufferTest, FileDescriptorSmallBlocks)
+{
+    auto sockets = socket_pair{};
+    ASSERT_NE(sockets.reader, -1);
+    sockets.write("123 foobar 456");
+    sockets.close_writer();
+
+    auto buf = scn::make_fd_scan_buffer(sockets.reader, 4);
+
+    auto result = scn::scan<int, std::string>(buf.get(), "{} {}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::get<0>(result->values()), 123);
+    EXPECT_EQ(std::get<1>(result->values()), "foobar");
+
+    auto second_result = scn::scan<int>(result->range(), "{}");
+    ASSERT_TRUE(second_result);
+    EXPECT_EQ(second_result->value(), 456);
+    EXPECT_TRUE(second_result->range().empty());
+}
+
+TEST(ScanBufferTest, FileDescriptorDiscardsCommittedInput)
+{
+    auto sockets = socket_pair{};
+    ASSERT_NE(sockets.reader, -1);
+    auto input = std::string{};
+    for (int i = 0; i < 1000; ++i) {
+        input += std::to_string(i);
+        input += ' ';
+    }
+    sockets.write(input);
+    sockets.close_writer();
+
+    auto buf = scn::make_fd_scan_buffer(sockets.reader, 16);
+    auto range = buf.get();
+    for (int i = 0; i < 1000; ++i) {
+        auto result = scn::scan<int>(range, "{}");
+        ASSERT_TRUE(result);
+        EXPECT_EQ(result->value(), i);
+
+        range = result->range();
+        ASSERT_TRUE(buf.sync(range.begin().position()));
+        EXPECT_LE(buf.putback_buffer().size(), 64u);
+    }
+    EXPECT_GT(buf.putback_offset(), 0);
+    EXPECT_EQ(buf.chars_available(),
+              static_cast<std::ptrdiff_t>(input.size()));
+    EXPECT_FALSE(scn::scan<int>(range, "{}"));
+}
+
+TEST(ScanBufferTest, FileDescriptorScanLoopDiscardsCommittedInput)
+{
+    auto sockets = socket_pair{};
+    ASSERT_NE(sockets.reader, -1);
+    auto input = std::string{};
+    for (int i = 0; i < 1000; ++i) {
+        input += std::to_string(i);
+        input += ' ';
+    }
+    sockets.write(input);
+    sockets.close_writer();
+
+    // No manual sync(): every scan commits what it has read
+    auto buf = scn::make_fd_scan_buffer(sockets.reader, 16);
+    auto range = buf.get();
+    for (int i = 0; i < 1000; ++i) {
+        auto result = scn::scan<int>(range, "{}");
+        ASSERT_TRUE(result);
+        EXPECT_EQ(result->value(), i);
+        range = result->range();
+        EXPECT_LE(buf.putback_buffer().size(), 64u);
+    }
+    EXPECT_GT(buf.putback_offset(), 0);
+    EXPECT_FALSE(scn::scan<int>(range, "{}"));
+}
+
+TEST(ScanBufferTest, FileDescriptorInvalid)
+{
+    auto buf = scn::make_fd_scan_buffer(-1);
+    EXPECT_EQ(collect(buf.get()), "");
+    EXPECT_TRUE(buf.has_read_error());
+    EXPECT_EQ(buf.read_error(), EBADF);
+
+    auto result = scn::scan<int>(buf.get(), "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_source_state);
+}
+
+TEST(ScanBufferTest, FileDescriptorWouldBlock)
+{
+    auto sockets = socket_pair{};
+    ASSERT_NE(sockets.reader, -1);
+    ASSERT_EQ(::fcntl(sockets.reader, F_SETFL,
+                      ::fcntl(sockets.reader, F_GETFL) | O_NONBLOCK),
+              0);
+    sockets.write("123");
+
+    auto buf = scn::make_fd_scan_buffer(sockets.reader);
+
+    // Reading the integer runs into EAGAIN after "123"
+    auto result = scn::scan<int>(buf.get(), "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_source_state);
+    EXPECT_TRUE(buf.read_error() == EAGAIN || buf.read_error() == EWOULDBLOCK);
+}
+
+#endif
@@ -22,6 +22,7 @@
 #if !SCN_DISABLE_CHRONO
 
 #include <scn/chrono.h>
+#include <scn/xchar.h>
 
 namespace {
 
@@ -273,6 +274,60 @@ TEST(ChronoScanTest, Subsecond)
     EXPECT_DOUBLE_EQ(result_dtc->value().subsec.value_or(-1.0), 0.789);
 }
 
+TEST(ChronoScanTest, Iso8601Timestamp)
+{
+    auto result = scn::scan<scn::datetime_components>(
+        "2024-08-23T23:06:10.25-04:30 rest", "{:%FT%H:%M:%.S%z}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::string_view(result->begin(), 5), " rest");
+    EXPECT_EQ(result->value().year, 2024);
+    EXPECT_EQ(result->value().mon, scn::August);
+    EXPECT_EQ(result->value().mday, 23);
+    EXPECT_EQ(result->value().hour, 23);
+    EXPECT_EQ(result->value().min, 6);
+    EXPECT_EQ(result->value().sec, 10);
+    EXPECT_DOUBLE_EQ(result->value().subsec.value_or(-1.0), 0.25);
+    EXPECT_EQ(result->value().tz_offset,
+              std::chrono::minutes{-(4 * 60 + 30)});
+
+    auto result_tz = scn::scan<scn::tm_with_tz>("2024-08-23 23:06:10+0200",
+                                                "{:%Y-%m-%d %T%z}");
+    ASSERT_TRUE(result_tz);
+    EXPECT_EQ(result_tz->value().tm_year, 2024 - 1900);
+    EXPECT_EQ(result_tz->value().tm_mon, 8 - 1);
+    EXPECT_EQ(result_tz->value().tm_mday, 23);
+    EXPECT_EQ(result_tz->value().tm_hour, 23);
+    EXPECT_EQ(result_tz->value().tm_min, 6);
+    EXPECT_EQ(result_tz->value().tm_sec, 10);
+    EXPECT_EQ(result_tz->value().tz_offset, std::chrono::hours{2});
+
+    // Not the fixed-width layout: read by the generic reader
+    auto result_tm =
+        scn::scan<std::tm>("2024-8-3T3:06:10", "{:%Y-%m-%dT%H:%M:%S}");
+    ASSERT_TRUE(result_tm);
+    EXPECT_EQ(result_tm->value().tm_mon, 8 - 1);
+    EXPECT_EQ(result_tm->value().tm_mday, 3);
+    EXPECT_EQ(result_tm->value().tm_hour, 3);
+
+    result_tm = scn::scan<std::tm>("2024-13-03T03:06:10", "{:%FT%T}");
+    ASSERT_FALSE(result_tm);
+    EXPECT_EQ(result_tm.error().code(), scn::scan_error::invalid_scanned_value);
+
+    result_tm = scn::scan<std::tm>("2024-12-03T03:06", "{:%FT%T}");
+    ASSERT_FALSE(result_tm);
+}
+
+TEST(ChronoScanTest, Iso8601TimestampWide)
+{
+    auto result = scn::scan<scn::datetime_components>(
+        L"2024-08-23T23:06:10+02:00", L"{:%Y-%m-%dT%H:%M:%S%z}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().year, 2024);
+    EXPECT_EQ(result->value().mday, 23);
+    EXPECT_EQ(result->value().sec, 10);
+    EXPECT_EQ(result->value().tz_offset, std::chrono::hours{2});
+}
+
 TEST(ChronoScanTest, ChronoCalendarTypes)
 {
     auto result_wd = scn::scan<scn::weekday>("Monday", "{:%a}");
@@ -303,19 +358,93 @@ TEST(ChronoScanTest, ChronoTimePoint)
     auto val = std::chrono::duration_cast<std::chrono::seconds>(
         result->value().time_since_epoch());
 
-    std::tm expected_tm{};
-    expected_tm.tm_sec = 10;
-    expected_tm.tm_min = 11;
-    expected_tm.tm_hour = 23;
-    expected_tm.tm_mday = 10;
-    expected_tm.tm_mon = 8;
-    expected_tm.tm_year = 2024 - 1900;
-    expected_tm.tm_wday = 0;
-    expected_tm.tm_yday = 0;
-    expected_tm.tm_isdst = -1;
-    auto expected_val = std::chrono::seconds{std::mktime(&expected_tm)};
-
-    EXPECT_EQ(val, expected_val);
+    // Interpreted as UTC, regardless of the local timezone
+    EXPECT_EQ(val, std::chrono::seconds{1726009870});
+}
+
+TEST(ChronoScanTest, ChronoTimePointWithOffsetAndSubsecond)
+{
+    using time_point_ms = std::chrono::time_point<std::chrono::system_clock,
+                                                  std::chrono::milliseconds>;
+
+    auto result = scn::scan<time_point_ms>("2024-09-10T23:11:10.250+02:00",
+                                           "{:%Y-%m-%dT%H:%M:%.S%z}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().time_since_epoch(),
+              std::chrono::milliseconds{(1726009870 - 2 * 3600) * 1000LL +
+                                        250});
+
+    result = scn::scan<time_point_ms>("1969-12-31 23:59:59", "{:%F %T}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().time_since_epoch(),
+              std::chrono::milliseconds{-1000});
+
+    result = scn::scan<time_point_ms>("UTC", "{:%Z}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
+TEST(ChronoScanTest, TimestampScanner)
+{
+    using namespace std::chrono;
+    auto timestamps = scn::timestamp_scanner<milliseconds>{"%FT%H:%M:%.S%z"};
+    auto scan_both = [&](std::string_view source) {
+        auto cached = timestamps.scan(source);
+        auto uncached = scn::scan<time_point<system_clock, milliseconds>>(
+            source, "{:%FT%H:%M:%.S%z}");
+        EXPECT_EQ(cached.has_value(), uncached.has_value()) << source;
+        if (cached && uncached) {
+            EXPECT_EQ(cached->value(), uncached->value()) << source;
+            EXPECT_EQ(cached->begin(), uncached->begin()) << source;
+        }
+        return cached;
+    };
+
+    auto result = scan_both("2024-09-10T23:11:10.250+02:00 first");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().time_since_epoch(),
+              milliseconds{(1726009870 - 2 * 3600) * 1000LL + 250});
+    EXPECT_EQ(std::string_view(result->begin(), 6), " first");
+
+    // Same prefix
+    result = scan_both("2024-09-10T23:11:59.5+02:00 second");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().time_since_epoch(),
+              milliseconds{(1726009870 - 2 * 3600 + 49) * 1000LL + 500});
+
+    // Different minute, different offset
+    result = scan_both("2024-09-10T23:12:00.0-0100");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().time_since_epoch(),
+              milliseconds{(1726009870 + 50 + 3600) * 1000LL});
+
+    // Not cacheable: falls back to the generic reader
+    EXPECT_TRUE(scan_both("  2024-09-10T23:12:00.0+01:00"));
+    EXPECT_TRUE(scan_both("2024-9-10T23:12:00.0+01:00"));
+    EXPECT_FALSE(scan_both("2024-09-10T23:12:61.0+01:00"));
+    EXPECT_FALSE(scan_both("2024-13-10T23:12:00.0+01:00"));
+    EXPECT_FALSE(scan_both("2024-09-10T23:12:00+01:00"));
+}
+
+TEST(ChronoScanTest, TimestampScannerOtherFormat)
+{
+    auto timestamps =
+        scn::timestamp_scanner<std::chrono::seconds>{"%d/%m/%Y %H:%M:%S"};
+    auto result = timestamps.scan("10/09/2024 23:11:10");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().time_since_epoch(),
+              std::chrono::seconds{1726009870});
+}
+
+TEST(ChronoScanTest, DaysFromCivil)
+{
+    EXPECT_EQ(scn::detail::days_from_civil(1970, 1, 1), 0);
+    EXPECT_EQ(scn::detail::days_from_civil(2000, 3, 1), 11017);
+    EXPECT_EQ(scn::detail::days_from_civil(2024, 2, 29), 19782);
+    EXPECT_EQ(scn::detail::days_from_civil(1600, 1, 1), -135140);
+    // Day 0 is the last day of the previous month
+    EXPECT_EQ(scn::detail::days_from_civil(2024, 3, 0),
+              scn::detail::days_from_civil(2024, 2, 29));
 }
 
 TEST(ChronoScanTest, Fuzz1)
@@ -93,6 +93,18 @@ TEST(CustomTypeTest, IntegerWrapperWithCustomFormatString)
     EXPECT_EQ(val, 0x123);
 }
 
+TEST(CustomTypeTest, IntegerWrapperWithCompiledFormatString)
+{
+    auto result =
+        scn::scan<integer_wrapper, char_wrapper>("123 c", SCN_COMPILE("{:x} {}"));
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result->range().empty());
+
+    auto [i, c] = result->values();
+    EXPECT_EQ(i.value, 0x123);
+    EXPECT_EQ(c.value, 'c');
+}
+
 // Wrapper over a variant,
 // with fully custom format string parsing
 struct variant_wrapper {
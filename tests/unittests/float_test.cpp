@@ -19,6 +19,12 @@
 
 #include <scn/scan.h>
 
+#include <array>
+#include <clocale>
+#include <cmath>
+#include <string>
+#include <vector>
+
 TEST(FloatTest, FloatWithSuffix)
 {
     auto result = scn::scan<double>("scn::scan for string_view: 0.0075ms",
@@ -34,6 +40,148 @@ TEST(FloatTest, FloatWithDoubleSign)
     ASSERT_FALSE(result);
 }
 
+TEST(FloatTest, LongDoubleWithCommaDecimalPointCLocale)
+{
+    // long double is parsed with strtold, which mustn't be affected by
+    // the global C locale, or change it
+    const char* loc = nullptr;
+    for (auto name : {"de_DE.UTF-8", "de_DE.utf8", "de_DE", "fi_FI.UTF-8",
+                      "fi_FI.utf8", "fi_FI"}) {
+        const std::string prev = std::setlocale(LC_NUMERIC, nullptr);
+        loc = std::setlocale(LC_NUMERIC, name);
+        if (loc) {
+            break;
+        }
+        std::setlocale(LC_NUMERIC, prev.c_str());
+    }
+    if (!loc) {
+        GTEST_SKIP() << "No locale with a comma decimal point available";
+    }
+    const std::string expected_locale = loc;
+
+    auto result = scn::scan<long double>("3.25", "{}");
+    const std::string locale_after = std::setlocale(LC_NUMERIC, nullptr);
+    std::setlocale(LC_NUMERIC, "C");
+
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), 3.25L);
+    EXPECT_TRUE(result->range().empty());
+    EXPECT_EQ(locale_after, expected_locale);
+}
+
+TEST(ScanFloatsTest, Simple)
+{
+    std::vector<double> values(4);
+    auto result = scn::scan_floats("1.5 -2e3\n+0.25 0x1p4", values);
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result->range().empty());
+    EXPECT_EQ(result->value(), 4);
+    EXPECT_DOUBLE_EQ(values[0], 1.5);
+    EXPECT_DOUBLE_EQ(values[1], -2e3);
+    EXPECT_DOUBLE_EQ(values[2], 0.25);
+    EXPECT_DOUBLE_EQ(values[3], 16.0);
+}
+TEST(ScanFloatsTest, InfAndNan)
+{
+    std::array<float, 3> values{};
+    auto result = scn::scan_floats("inf -infinity nan", values);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), 3);
+    EXPECT_TRUE(std::isinf(values[0]) && values[0] > 0);
+    EXPECT_TRUE(std::isinf(values[1]) && values[1] < 0);
+    EXPECT_TRUE(std::isnan(values[2]));
+}
+TEST(ScanFloatsTest, CustomSeparator)
+{
+    std::vector<double> values(8);
+    auto result = scn::scan_floats("1.25,2.5 ,3e1,,4", values, ',');
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::string_view(result->range().data(), result->range().size()),
+              ",,4");
+    EXPECT_EQ(result->value(), 3);
+    EXPECT_DOUBLE_EQ(values[0], 1.25);
+    EXPECT_DOUBLE_EQ(values[1], 2.5);
+    EXPECT_DOUBLE_EQ(values[2], 30.0);
+}
+TEST(ScanFloatsTest, StopsAtNonFloat)
+{
+    std::vector<double> values(8);
+    auto result = scn::scan_floats("1 2 foo", values);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), 2);
+    EXPECT_EQ(std::string_view(result->range().data(), result->range().size()),
+              " foo");
+}
+TEST(ScanFloatsTest, StopsAtEmptyValue)
+{
+    std::vector<double> values(8);
+    auto result = scn::scan_floats("1.5;;2", values, ';');
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), 1);
+    EXPECT_EQ(std::string_view(result->range().data(), result->range().size()),
+              ";;2");
+
+    std::string_view source{";1.5"};
+    result = scn::scan_floats(source, values, ';');
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+    EXPECT_EQ(result.error().count(), 0);
+    EXPECT_EQ(result.error().position(), source.begin());
+}
+TEST(ScanFloatsTest, InvalidValueAfterFirstIsError)
+{
+    std::vector<float> values(4);
+    std::string_view source{"1,2,1e999"};
+    auto result = scn::scan_floats(source, values, ',');
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::value_positive_overflow);
+    EXPECT_EQ(result.error().count(), 2);
+    EXPECT_EQ(result.error().position(), source.begin() + 4);
+    EXPECT_FLOAT_EQ(values[0], 1.0f);
+    EXPECT_FLOAT_EQ(values[1], 2.0f);
+
+    source = "1 -foo";
+    result = scn::scan_floats(source, values);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+    EXPECT_EQ(result.error().count(), 1);
+    EXPECT_EQ(result.error().position(), source.begin() + 2);
+}
+TEST(ScanFloatsTest, ManyValues)
+{
+    std::string input{};
+    for (int i = 0; i < 1000; ++i) {
+        input += std::to_string(i);
+        input += ".5;";
+    }
+
+    std::vector<double> values(1000);
+    auto result = scn::scan_floats(input, values, ';');
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), 1000);
+    EXPECT_EQ(std::string_view(result->range().data(), result->range().size()),
+              ";");
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_DOUBLE_EQ(values[static_cast<size_t>(i)], i + 0.5);
+    }
+}
+TEST(ScanFloatsTest, Errors)
+{
+    std::vector<double> values(4);
+    auto result = scn::scan_floats("", values);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::end_of_input);
+    EXPECT_EQ(result.error().count(), 0);
+
+    result = scn::scan_floats("foo", values);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+
+    result = scn::scan_floats("1 1e999999", values);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::value_positive_overflow);
+}
+
 #if SCN_HAS_STD_F16
 TEST(FloatTest, Float16)
 {
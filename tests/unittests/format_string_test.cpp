@@ -286,3 +286,68 @@ TEST(FormatStringTest, FuzzingError3)
     auto result = scn::scan<std::string>("{:G}", scn::runtime_format("{:G}"));
     ASSERT_FALSE(result);
 }
+
+TEST(CompiledFormatTest, Ops)
+{
+    auto format = SCN_COMPILE("a{} {{{:x}}}");
+    using compiled =
+        scn::compiled_format<decltype(format), std::string_view, int, int>;
+    using kind_type = scn::detail::compiled_format_op<char>::kind_type;
+
+    static_assert(compiled::size == 6);
+    static_assert(compiled::ops[0].kind == kind_type::literal);
+    static_assert(compiled::ops[0].text == "a");
+    static_assert(compiled::ops[1].kind == kind_type::default_field);
+    static_assert(compiled::ops[1].arg_id == 0);
+    static_assert(compiled::ops[2].text == " ");
+    static_assert(compiled::ops[3].text == "{");
+    static_assert(compiled::ops[4].kind == kind_type::specs_field);
+    static_assert(compiled::ops[4].arg_id == 1);
+    static_assert(compiled::ops[4].specs.get_base() == 16);
+    static_assert(compiled::ops[5].text == "}");
+}
+
+TEST(CompiledFormatTest, Simple)
+{
+    auto result = scn::scan<int>("42", SCN_COMPILE("{}"));
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), 42);
+    EXPECT_TRUE(result->range().empty());
+}
+
+TEST(CompiledFormatTest, MultipleFieldsWithSpecsAndLiterals)
+{
+    auto result = scn::scan<int, std::string, double>(
+        "id=ff name:  foo, 3.5 rest",
+        SCN_COMPILE("id={:x} name: {:[a-z]}, {}"));
+    ASSERT_TRUE(result);
+    auto [i, s, d] = result->values();
+    EXPECT_EQ(i, 0xff);
+    EXPECT_EQ(s, "foo");
+    EXPECT_DOUBLE_EQ(d, 3.5);
+    EXPECT_EQ(std::string_view(result->range().data(), result->range().size()),
+              " rest");
+}
+
+TEST(CompiledFormatTest, ExplicitArgIds)
+{
+    auto result = scn::scan<int, int>("1 2", SCN_COMPILE("{1} {0}"));
+    ASSERT_TRUE(result);
+    auto [a, b] = result->values();
+    EXPECT_EQ(a, 2);
+    EXPECT_EQ(b, 1);
+}
+
+TEST(CompiledFormatTest, MismatchingLiteral)
+{
+    auto result = scn::scan<int, int>("1,2", SCN_COMPILE("{};{}"));
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_literal);
+}
+
+TEST(CompiledFormatTest, InvalidValue)
+{
+    auto result = scn::scan<int>("abc", SCN_COMPILE("{:d}"));
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}
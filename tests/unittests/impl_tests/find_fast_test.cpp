@@ -157,3 +157,55 @@ TEST(FindClassicNonspaceNarrowFastTest, EmojiInput)
             scn::impl::find_classic_nonspace_narrow_fast(input.substr(4))),
         input.data() + 5);
 }
+
+TEST(FindClassicSpaceNarrowFastTest, EveryPositionInLongInput)
+{
+    for (auto space : " \t\n\v\f\r"sv) {
+        for (std::size_t i = 0; i < 70; ++i) {
+            auto src = std::string(80, 'a');
+            src[i] = space;
+            EXPECT_EQ(scn::impl::find_classic_space_narrow_fast(src) -
+                          std::string_view{src}.begin(),
+                      static_cast<std::ptrdiff_t>(i));
+        }
+    }
+}
+TEST(FindClassicSpaceNarrowFastTest, NonAsciiSpaceInLongInput)
+{
+    // U+2028 LINE SEPARATOR
+    auto src = std::string(40, 'a') + "ä\u2028" + std::string(40, ' ');
+    EXPECT_EQ(scn::impl::find_classic_space_narrow_fast(src) -
+                  std::string_view{src}.begin(),
+              42);
+}
+
+TEST(FindClassicNonspaceNarrowFastTest, LongSpaceInput)
+{
+    auto src = std::string{};
+    for (int i = 0; i < 12; ++i) {
+        src += " \t\n\v\f\r";
+    }
+    src += "\u2028\u2028x ";
+    EXPECT_EQ(scn::impl::find_classic_nonspace_narrow_fast(src) -
+                  std::string_view{src}.begin(),
+              78);
+    EXPECT_EQ(scn::impl::find_classic_nonspace_narrow_fast(
+                  std::string_view{src}.substr(0, 72)),
+              std::string_view{src}.substr(0, 72).end());
+}
+
+TEST(FindNondecimalDigitNarrowFastTest, EveryLength)
+{
+    for (std::size_t i = 0; i < 70; ++i) {
+        auto digits = std::string(i, '7');
+        EXPECT_EQ(scn::impl::find_nondecimal_digit_narrow_fast(digits),
+                  std::string_view{digits}.end());
+
+        for (auto terminator : {"x"sv, "/"sv, ":"sv, "ä"sv}) {
+            auto src = digits + std::string{terminator} + "123";
+            EXPECT_EQ(scn::impl::find_nondecimal_digit_narrow_fast(src) -
+                          std::string_view{src}.begin(),
+                      static_cast<std::ptrdiff_t>(i));
+        }
+    }
+}
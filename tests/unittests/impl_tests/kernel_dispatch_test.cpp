@@ -0,0 +1,225 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "../wrapped_gtest.h"
+
+#include <scn/impl.h>
+
+#include <algorithm>
+#include <random>
+
+using namespace std::string_view_literals;
+
+namespace {
+constexpr scn::impl::kernel_isa all_kernel_isas[] = {
+    scn::impl::kernel_isa::scalar, scn::impl::kernel_isa::sse2,
+    scn::impl::kernel_isa::avx2, scn::impl::kernel_isa::avx512bw,
+    scn::impl::kernel_isa::neon};
+
+std::vector<std::string> make_kernel_inputs()
+{
+    // ASCII letters, digits, whitespace, and UTF-8 fragments,
+    // some of them invalid
+    constexpr std::string_view pieces[] = {
+        "a"sv,  "Z"sv,  "0"sv, "7"sv,        "9"sv,        " "sv,
+        "\t"sv, "\n"sv, "/"sv, ":"sv,        "ä"sv,   " "sv,
+        "\xc3"sv, "\x80"sv, "\xed\xa0\x80"sv, "\xf0\x9f\x98\x82"sv};
+
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<std::size_t> piece_dist{
+        0, std::size(pieces) - 1};
+    std::uniform_int_distribution<std::size_t> length_dist{0, 150};
+
+    std::vector<std::string> inputs;
+    for (int i = 0; i < 500; ++i) {
+        // Mostly a single piece repeated, so that long runs happen
+        const auto filler = pieces[piece_dist(rng) % 8];
+        auto str = std::string{};
+        const auto len = length_dist(rng);
+        while (str.size() < len) {
+            str += (rng() % 16 == 0) ? pieces[piece_dist(rng)] : filler;
+        }
+        inputs.push_back(std::move(str));
+    }
+    return inputs;
+}
+}  // namespace
+
+TEST(KernelDispatchTest, DefaultTableIsSupported)
+{
+    const auto& table = scn::impl::get_kernel_dispatch_table();
+    EXPECT_TRUE(scn::impl::is_kernel_isa_supported(table.isa));
+    EXPECT_TRUE(scn::impl::is_kernel_isa_supported(
+        scn::impl::kernel_isa::scalar));
+}
+
+TEST(KernelDispatchTest, KernelsMatchScalar)
+{
+    const auto& scalar =
+        scn::impl::get_kernel_dispatch_table(scn::impl::kernel_isa::scalar);
+    const auto inputs = make_kernel_inputs();
+
+    for (auto isa : all_kernel_isas) {
+        if (!scn::impl::is_kernel_isa_supported(isa)) {
+            continue;
+        }
+        const auto& table = scn::impl::get_kernel_dispatch_table(isa);
+        EXPECT_EQ(table.isa, isa);
+
+        for (const auto& input : inputs) {
+            SCOPED_TRACE(testing::Message()
+                         << "isa: " << static_cast<int>(isa)
+                         << ", input: " << testing::PrintToString(input));
+
+            EXPECT_EQ(
+                table.find_classic_space_or_nonascii(input.data(),
+                                                     input.size()),
+                scalar.find_classic_space_or_nonascii(input.data(),
+                                                      input.size()));
+            EXPECT_EQ(
+                table.find_classic_nonspace_or_nonascii(input.data(),
+                                                        input.size()),
+                scalar.find_classic_nonspace_or_nonascii(input.data(),
+                                                         input.size()));
+            EXPECT_EQ(
+                table.find_nondecimal_digit(input.data(), input.size()),
+                scalar.find_nondecimal_digit(input.data(), input.size()));
+            EXPECT_EQ(table.find_nonascii(input.data(), input.size()),
+                      scalar.find_nonascii(input.data(), input.size()));
+            EXPECT_EQ(table.validate_utf8(input.data(), input.size()),
+                      scn::impl::validate_unicode<char>(input));
+
+            uint64_t value{}, scalar_value{};
+            const auto end = input.data() + input.size();
+            EXPECT_EQ(table.parse_decimal_digits(input.data(), end, value),
+                      scalar.parse_decimal_digits(input.data(), end,
+                                                  scalar_value));
+            EXPECT_EQ(value, scalar_value);
+        }
+    }
+}
+
+TEST(KernelDispatchTest, ValidateUtf8AcrossBlockBoundaries)
+{
+    // Valid, truncated, too large, and stray code units
+    constexpr std::string_view fragments[] = {
+        "\xc3\xa4"sv,         "\xe2\x82\xac"sv,     "\xf0\x9f\x98\x82"sv,
+        "\xf4\x8f\xbf\xbf"sv, "\xc0\x80"sv,         "\xed\xa0\x80"sv,
+        "\xc3"sv,             "\xe2\x82"sv,         "\xf0\x9f\x98"sv,
+        "\x80"sv,             "\xa4\xa4"sv,         "\xf4\x90\x80\x80"sv,
+        "\xf5\x80\x80\x80"sv, "\xf8\x88\x80\x80"sv, "\xff"sv,
+        "\xc3\xa4\xa4"sv};
+
+    for (auto isa : all_kernel_isas) {
+        if (!scn::impl::is_kernel_isa_supported(isa)) {
+            continue;
+        }
+        const auto& table = scn::impl::get_kernel_dispatch_table(isa);
+
+        for (std::size_t offset = 0; offset < 70; ++offset) {
+            for (const auto& fragment : fragments) {
+                for (std::string_view suffix : {""sv, "a"sv, "\xc3\xa4"sv}) {
+                    auto input = std::string(offset, 'x');
+                    input += fragment;
+                    input += suffix;
+                    SCOPED_TRACE(testing::Message()
+                                 << "isa: " << static_cast<int>(isa)
+                                 << ", input: "
+                                 << testing::PrintToString(input));
+                    EXPECT_EQ(table.validate_utf8(input.data(), input.size()),
+                              scn::impl::validate_unicode<char>(input));
+                }
+            }
+        }
+    }
+}
+
+TEST(KernelDispatchTest, TranscodeAsciiPrefix)
+{
+    const auto inputs = make_kernel_inputs();
+
+    for (auto isa : all_kernel_isas) {
+        if (!scn::impl::is_kernel_isa_supported(isa)) {
+            continue;
+        }
+        const auto& table = scn::impl::get_kernel_dispatch_table(isa);
+
+        for (const auto& input : inputs) {
+            SCOPED_TRACE(testing::Message()
+                         << "isa: " << static_cast<int>(isa)
+                         << ", input: " << testing::PrintToString(input));
+            const auto ascii_prefix = static_cast<std::size_t>(
+                std::find_if(input.begin(), input.end(),
+                             [](char ch) {
+                                 return static_cast<unsigned char>(ch) >= 0x80;
+                             }) -
+                input.begin());
+
+            std::u16string utf16(input.size(), u'\0');
+            const auto n16 = table.widen_ascii_to_utf16(
+                input.data(), input.size(), utf16.data());
+            EXPECT_LE(n16, ascii_prefix);
+            EXPECT_TRUE(std::equal(input.data(), input.data() + n16,
+                                   utf16.data()));
+
+            std::u32string utf32(input.size(), U'\0');
+            const auto n32 = table.widen_ascii_to_utf32(
+                input.data(), input.size(), utf32.data());
+            EXPECT_LE(n32, ascii_prefix);
+            EXPECT_TRUE(std::equal(input.data(), input.data() + n32,
+                                   utf32.data()));
+
+            std::u32string wide(input.begin(), input.end());
+            for (auto& ch : wide) {
+                ch = static_cast<unsigned char>(ch);
+            }
+            std::string narrowed(wide.size(), '\0');
+            const auto n8 = table.narrow_ascii_from_utf32(
+                wide.data(), wide.size(), narrowed.data());
+            EXPECT_LE(n8, ascii_prefix);
+            EXPECT_EQ(narrowed.substr(0, n8), input.substr(0, n8));
+        }
+    }
+}
+
+TEST(KernelDispatchTest, ParseDecimalDigitsLongRuns)
+{
+    constexpr std::pair<std::string_view, uint64_t> cases[] = {
+        {"1234567890123456"sv, 1234567890123456u},
+        {"12345678901234567x"sv, 12345678901234567u},
+        {"0000000000000000123"sv, 123u},
+        {"18446744073709551615"sv, 18446744073709551615u},
+        {"9876543210987654:21"sv, 9876543210987654u},
+    };
+
+    for (auto isa : all_kernel_isas) {
+        if (!scn::impl::is_kernel_isa_supported(isa)) {
+            continue;
+        }
+        const auto& table = scn::impl::get_kernel_dispatch_table(isa);
+        for (auto [input, expected] : cases) {
+            SCOPED_TRACE(input);
+            uint64_t value{};
+            const auto end = table.parse_decimal_digits(
+                input.data(), input.data() + input.size(), value);
+            EXPECT_EQ(value, expected);
+            const auto digits_end =
+                std::min(input.find_first_not_of("0123456789"), input.size());
+            EXPECT_EQ(end, input.data() + digits_end);
+        }
+    }
+}
@@ -19,6 +19,7 @@
 
 #include <scn/impl.h>
 
+#include <algorithm>
 #include <optional>
 
 using namespace std::string_view_literals;
@@ -427,3 +428,109 @@ TYPED_TEST(StringCharacterSetReaderTest, MultipleLiteralNonAsciiCharacters)
     EXPECT_NE(*ret, src.end());
     EXPECT_TRUE(this->check_value(val, "öä"));
 }
+
+namespace {
+std::pair<std::ptrdiff_t, std::ptrdiff_t> validated_range(std::ptrdiff_t first,
+                                                          std::ptrdiff_t last)
+{
+    return {first, last};
+}
+}  // namespace
+
+TEST(StringReaderValidationTest, CachesValidatedLine)
+{
+    scn::detail::scan_push_buffer buf;
+    buf.feed("foo bar\nbaz\xff\n");
+
+    EXPECT_TRUE(scn::impl::validate_unicode_in_scan_buffer(buf, 0, "foo"sv));
+    EXPECT_EQ(buf.validated_encoding_range(), validated_range(0, 8));
+
+    // Later fields on the same line are already validated
+    EXPECT_TRUE(scn::impl::validate_unicode_in_scan_buffer(buf, 4, "bar"sv));
+    EXPECT_EQ(buf.validated_encoding_range(), validated_range(0, 8));
+
+    EXPECT_FALSE(
+        scn::impl::validate_unicode_in_scan_buffer(buf, 8, "baz\xff"sv));
+    EXPECT_EQ(buf.validated_encoding_range(), validated_range(0, 8));
+}
+
+TEST(StringReaderValidationTest, InvalidRestOfLine)
+{
+    scn::detail::scan_push_buffer buf;
+    buf.feed("foo \xff\n");
+
+    EXPECT_TRUE(scn::impl::validate_unicode_in_scan_buffer(buf, 0, "foo"sv));
+    EXPECT_EQ(buf.validated_encoding_range(), validated_range(0, 3));
+    EXPECT_FALSE(scn::impl::validate_unicode_in_scan_buffer(buf, 4, "\xff"sv));
+}
+
+TEST(StringReaderValidationTest, PushBufferSyncKeepsCache)
+{
+    scn::detail::scan_push_buffer buf;
+    buf.feed("foo bar\n");
+
+    EXPECT_TRUE(scn::impl::validate_unicode_in_scan_buffer(buf, 0, "foo"sv));
+    ASSERT_TRUE(buf.sync(4));
+    EXPECT_EQ(buf.validated_encoding_range(), validated_range(0, 4));
+}
+
+TEST(CharsetNonasciiLookupTest, RangesAreMerged)
+{
+    scn::impl::nonascii_specs_handler handler;
+    ASSERT_TRUE(scn::impl::parse_charset_nonascii_ranges(
+        "[ä-öа-яё-ёб-ж一-龥龦]"sv, handler));
+
+    const std::vector<std::pair<char32_t, char32_t>> expected{
+        {U'ä', U'ö' + 1},
+        {U'а', U'я' + 1},
+        {U'ё', U'ё' + 1},
+        {0x4e00, 0x9fa7},
+    };
+    EXPECT_EQ(handler.extra_ranges, expected);
+}
+
+TEST(CharsetNonasciiLookupTest, MatchesLinearSearch)
+{
+    // Many partially covered blocks, to overflow the inline leaves,
+    // full blocks, and ranges above the BMP
+    std::vector<std::pair<char32_t, char32_t>> ranges;
+    for (char32_t cp = 0x100; cp < 0x1800; cp += 0x90) {
+        ranges.emplace_back(cp, cp + 0x21);
+    }
+    ranges.emplace_back(0x4dff, 0x9fa6);
+    ranges.emplace_back(0xfff0, 0x10010);
+    ranges.emplace_back(0x1f600, 0x1f650);
+
+    const auto lookup =
+        scn::detail::charset_nonascii_lookup{ranges.data(), ranges.size()};
+
+    for (char32_t cp = 0x80; cp < 0x20000; ++cp) {
+        const bool expected =
+            std::any_of(ranges.begin(), ranges.end(), [cp](const auto& r) {
+                return r.first <= cp && cp < r.second;
+            });
+        ASSERT_EQ(lookup.contains(cp), expected) << static_cast<uint32_t>(cp);
+        ASSERT_EQ(scn::detail::charset_nonascii_lookup::ranges_contain(
+                      ranges.data(), ranges.size(), cp),
+                  expected)
+            << static_cast<uint32_t>(cp);
+        // Few enough ranges to be searched linearly
+        const bool expected_in_last_three =
+            std::any_of(ranges.end() - 3, ranges.end(), [cp](const auto& r) {
+                return r.first <= cp && cp < r.second;
+            });
+        ASSERT_EQ(scn::detail::charset_nonascii_lookup::ranges_contain(
+                      ranges.data() + ranges.size() - 3, 3, cp),
+                  expected_in_last_three)
+            << static_cast<uint32_t>(cp);
+    }
+}
+
+TEST(CharsetNonasciiLookupTest, Empty)
+{
+    const auto lookup = scn::detail::charset_nonascii_lookup{nullptr, 0};
+    EXPECT_FALSE(lookup.contains(U'ä'));
+    EXPECT_FALSE(lookup.contains(0x1f600));
+    EXPECT_FALSE(
+        scn::detail::charset_nonascii_lookup::ranges_contain(nullptr, 0, U'ä'));
+}
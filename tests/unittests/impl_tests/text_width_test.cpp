@@ -37,6 +37,39 @@ TEST(CalculateTextWidthTest, EmojiWidth)
 {
     EXPECT_EQ(scn::impl::calculate_valid_text_width("😀"sv), 2);
 }
+TEST(CalculateTextWidthTest, DoubleWidthRangeBoundaries)
+{
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x10ff}), 1);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x1100}), 2);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x115f}), 2);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x1160}), 1);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x303e}), 2);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x303f}), 1);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x3040}), 2);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x3fffd}), 2);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x3fffe}), 1);
+}
+TEST(CalculateTextWidthTest, LongAsciiRunsWithWideCodePoints)
+{
+    auto input = std::string{};
+    auto expected = std::size_t{0};
+    for (int i = 0; i < 20; ++i) {
+        input += std::string(static_cast<std::size_t>(i * 7), 'a');
+        input += "ä😀中";
+        expected += static_cast<std::size_t>(i * 7) + 1 + 2 + 2;
+    }
+    EXPECT_EQ(scn::impl::calculate_text_width(std::string_view{input}),
+              expected);
+    EXPECT_EQ(scn::impl::calculate_valid_text_width(std::string_view{input}),
+              expected);
+    EXPECT_EQ(scn::impl::calculate_text_width(
+                  std::wstring_view{L"aä😀中"}),
+              6);
+}
+TEST(CalculateTextWidthTest, InvalidCodeUnits)
+{
+    EXPECT_EQ(scn::impl::calculate_text_width("a\xff" "b\xc3"sv), 4);
+}
 
 TEST(TakeWidthViewTest, TakeAllSimpleCodePoints)
 {
@@ -106,3 +106,72 @@ TEST(TranscodeTest, Unicode)
 
     EXPECT_EQ(narrowed, in);
 }
+
+TEST(TranscodeTest, LongAsciiRunsWithNonAscii)
+{
+    auto in = std::string(100, 'a') + "\xc3\xa4" + std::string(70, 'b') +
+              "\xf0\x9f\x98\x82" + std::string(33, 'c');
+    auto expected = std::wstring(100, L'a') + L"\u00e4" +
+                    std::wstring(70, L'b') + L"\U0001F602" +
+                    std::wstring(33, L'c');
+
+    std::wstring widened{};
+    scn::impl::transcode_to_string(std::string_view{in}, widened);
+    EXPECT_EQ(widened, expected);
+
+    std::string narrowed{};
+    scn::impl::transcode_to_string(
+        std::wstring_view{widened.data(), widened.size()}, narrowed);
+    EXPECT_EQ(narrowed, in);
+
+    widened.clear();
+    scn::impl::transcode_valid_to_string(std::string_view{in}, widened);
+    EXPECT_EQ(widened, expected);
+}
+
+TEST(TranscodeTest, AppendsToDestination)
+{
+    std::wstring widened = L"xy";
+    scn::impl::transcode_to_string("z\xc3\xa4"sv, widened);
+    EXPECT_EQ(widened, L"xyz\u00e4");
+
+    std::string narrowed = "xy";
+    scn::impl::transcode_to_string(L"z\u00e4"sv, narrowed);
+    EXPECT_EQ(narrowed, "xyz\xc3\xa4");
+}
+
+TEST(TranscodeTest, InvalidUtf8)
+{
+    std::wstring widened{};
+    scn::impl::transcode_to_string(
+        std::string_view{std::string(40, 'a') + "\x80" + "b\xc3"}, widened);
+    EXPECT_EQ(widened, std::wstring(40, L'a') + L"\ufffdb\ufffd");
+}
+
+TEST(TranscodeTest, Utf16SurrogatePairs)
+{
+    std::u16string utf16{};
+    scn::impl::transcode_to_string("a\xf0\x9f\x98\x82"sv, utf16);
+    EXPECT_EQ(utf16, u"a\U0001F602");
+    EXPECT_EQ(utf16, (std::u16string{u'a', 0xd83d, 0xde02}));
+
+    utf16.clear();
+    scn::impl::transcode_to_string(U"\U0001F602b"sv, utf16);
+    EXPECT_EQ(utf16, (std::u16string{0xd83d, 0xde02, u'b'}));
+}
+
+TEST(TranscodeTest, NarrowGrowsDestination)
+{
+    std::u32string in(40, U'a');
+    std::string expected(40, 'a');
+    for (int i = 0; i < 100; ++i) {
+        in += U'\U0001F602';
+        expected += "\xf0\x9f\x98\x82";
+    }
+    in += static_cast<char32_t>(0x110000);
+    expected += "\xef\xbf\xbd";
+
+    std::string narrowed{};
+    scn::impl::transcode_to_string(std::u32string_view{in}, narrowed);
+    EXPECT_EQ(narrowed, expected);
+}
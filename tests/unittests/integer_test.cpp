@@ -19,7 +19,9 @@
 
 #include <scn/scan.h>
 
+#include <array>
 #include <deque>
+#include <vector>
 
 namespace {
 template <typename... Args>
@@ -422,8 +424,63 @@ TEST(IntegerTest, UInt128)
     EXPECT_EQ(result->begin(), input.end());
     EXPECT_EQ(result->value(), 123456789);
 }
+TEST(IntegerTest, UInt128_Max)
+{
+    std::string_view input = "340282366920938463463374607431768211455 ";
+    auto result = scn::scan<scn::uint128>(input, "{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->begin(), input.end() - 1);
+    EXPECT_TRUE(result->value() == std::numeric_limits<scn::uint128>::max());
+}
+TEST(IntegerTest, UInt128_Overflow)
+{
+    auto result = scn::scan<scn::uint128>(
+        std::string_view{"340282366920938463463374607431768211456"}, "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::value_positive_overflow);
+}
+TEST(IntegerTest, Int128_Min)
+{
+    std::string_view input = "-170141183460469231731687303715884105728";
+    auto result = scn::scan<scn::int128>(input, "{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->begin(), input.end());
+    EXPECT_TRUE(result->value() == std::numeric_limits<scn::int128>::min());
+}
+TEST(IntegerTest, Int128_Overflow)
+{
+    auto result = scn::scan<scn::int128>(
+        std::string_view{"170141183460469231731687303715884105728"}, "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::value_positive_overflow);
+}
+TEST(IntegerTest, Int128_DigitRunEndsInsideChunk)
+{
+    std::string_view input = "12345678901234567890123x456";
+    auto result = scn::scan<scn::int128>(input, "{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->begin(), input.begin() + 23);
+    EXPECT_TRUE(result->value() ==
+                scn::int128{12345678901234567} * 1000000 + 890123);
+}
 #endif
 
+TEST(IntegerTest, UInt64_SixteenDigitRuns)
+{
+    std::string_view input = "18446744073709551615 1234567890123456x";
+    auto result = scn::scan<std::uint64_t, std::uint64_t>(input, "{} {}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::get<0>(result->values()),
+              std::numeric_limits<std::uint64_t>::max());
+    EXPECT_EQ(std::get<1>(result->values()), 1234567890123456u);
+    EXPECT_EQ(result->begin(), input.end() - 1);
+
+    auto overflow = scn::scan<std::uint64_t>(std::string_view{"18446744073709551616"}, "{}");
+    ASSERT_FALSE(overflow);
+    EXPECT_EQ(overflow.error().code(),
+              scn::scan_error::value_positive_overflow);
+}
+
 TEST(IntegerTest, HexNoPrefixFollowedByNonDigit_Default)
 {
     std::string_view input = "fg";
@@ -588,6 +645,127 @@ TEST(ScanIntTest, Empty)
     EXPECT_EQ(result.error().code(), scn::scan_error::end_of_input);
 }
 
+TEST(ScanIntsTest, Simple)
+{
+    std::vector<int> values(3);
+    auto result = scn::scan_ints("1 -2  +3", values);
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result->range().empty());
+    EXPECT_EQ(result->value(), 3);
+    EXPECT_EQ(values, (std::vector<int>{1, -2, 3}));
+}
+TEST(ScanIntsTest, StopsWhenOutputIsFull)
+{
+    std::array<unsigned, 2> values{};
+    auto result = scn::scan_ints(" 10\n20\t30", values);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::string_view(result->range().data(), result->range().size()),
+              "\t30");
+    EXPECT_EQ(result->value(), 2);
+    EXPECT_EQ(values[0], 10);
+    EXPECT_EQ(values[1], 20);
+}
+TEST(ScanIntsTest, StopsAtNonInteger)
+{
+    std::vector<long long> values(8);
+    auto result = scn::scan_ints("1 2 3 foo", values);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::string_view(result->range().data(), result->range().size()),
+              " foo");
+    EXPECT_EQ(result->value(), 3);
+    EXPECT_EQ(values[2], 3);
+}
+TEST(ScanIntsTest, CustomSeparator)
+{
+    std::vector<int> values(8);
+    auto result = scn::scan_ints("1,2 , 3,,4", values, ',');
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::string_view(result->range().data(), result->range().size()),
+              ",,4");
+    EXPECT_EQ(result->value(), 3);
+    EXPECT_EQ(values[0], 1);
+    EXPECT_EQ(values[1], 2);
+    EXPECT_EQ(values[2], 3);
+}
+TEST(ScanIntsTest, ManyValues)
+{
+    std::string input{};
+    for (int i = 0; i < 1000; ++i) {
+        input += std::to_string(i * 123457 - 50'000'000);
+        input += ' ';
+    }
+
+    std::vector<int> values(1000);
+    auto result = scn::scan_ints(input, values);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), 1000);
+    EXPECT_EQ(std::string_view(result->range().data(), result->range().size()),
+              " ");
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(values[static_cast<size_t>(i)], i * 123457 - 50'000'000);
+    }
+}
+TEST(ScanIntsTest, EmptyOutput)
+{
+    std::vector<int> values{};
+    auto result = scn::scan_ints("1 2", values);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), 0);
+    EXPECT_EQ(result->range().size(), 3);
+}
+TEST(ScanIntsTest, Empty)
+{
+    std::vector<int> values(1);
+    std::string_view source{"  "};
+    auto result = scn::scan_ints(source, values);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::end_of_input);
+    EXPECT_EQ(result.error().count(), 0);
+    EXPECT_EQ(result.error().position(), source.end());
+}
+TEST(ScanIntsTest, InvalidFirstValue)
+{
+    std::vector<int> values(1);
+    std::string_view source{" foo"};
+    auto result = scn::scan_ints(source, values);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+    EXPECT_EQ(result.error().count(), 0);
+    EXPECT_EQ(result.error().position(), source.begin() + 1);
+}
+TEST(ScanIntsTest, RangeError)
+{
+    std::vector<int> values(4);
+    std::string_view source{"1 2 99999999999 4"};
+    auto result = scn::scan_ints(source, values);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::value_positive_overflow);
+    EXPECT_EQ(result.error().count(), 2);
+    EXPECT_EQ(result.error().position(), source.begin() + 4);
+    EXPECT_EQ(values[0], 1);
+    EXPECT_EQ(values[1], 2);
+}
+TEST(ScanIntsTest, NegativeUnsigned)
+{
+    std::vector<unsigned> values(4);
+    std::string_view source{"1, -2"};
+    auto result = scn::scan_ints(source, values, ',');
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+    EXPECT_EQ(result.error().count(), 1);
+    EXPECT_EQ(result.error().position(), source.begin() + 3);
+    EXPECT_EQ(values[0], 1);
+}
+TEST(ScanIntsTest, TrailingSeparator)
+{
+    std::vector<int> values(4);
+    auto result = scn::scan_ints("1, 2, ", values, ',');
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), 2);
+    EXPECT_EQ(std::string_view(result->range().data(), result->range().size()),
+              ", ");
+}
+
 #if !SCN_IS_BIG_ENDIAN
 TEST(ScanIntExhaustiveValidTest, Simple)
 {
@@ -0,0 +1,166 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "wrapped_gtest.h"
+
+#include <scn/parallel.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std::string_view_literals;
+
+namespace {
+std::string make_lines(int count)
+{
+    std::string result;
+    for (int i = 0; i < count; ++i) {
+        result += "line" + std::to_string(i) + " " + std::to_string(i * 2);
+        result += '\n';
+    }
+    return result;
+}
+}  // namespace
+
+TEST(ParallelScanTest, SplitAtDelimiters)
+{
+    auto buffer = "aaa\nbbb\nccc\nddd"sv;
+    std::string_view chunks[3]{};
+    scn::detail::split_at_delimiters(buffer, '\n', chunks, 3);
+    EXPECT_EQ(chunks[0], "aaa\nbbb\n");
+    EXPECT_EQ(chunks[1], "ccc\n");
+    EXPECT_EQ(chunks[2], "ddd");
+
+    std::string_view many_chunks[8]{};
+    scn::detail::split_at_delimiters("abc\n", '\n', many_chunks, 8);
+    std::string joined;
+    for (auto chunk : many_chunks) {
+        joined += chunk;
+    }
+    EXPECT_EQ(joined, "abc\n");
+}
+
+TEST(ParallelScanTest, InOrder)
+{
+    // Large enough to be split into multiple chunks
+    const auto buffer = make_lines(100000);
+
+    int expected = 0;
+    auto result = scn::parallel_scan_lines<std::string, int>(
+        buffer, "{} {}",
+        [&](std::string_view line, auto& r) {
+            ASSERT_TRUE(r) << line;
+            auto& [name, value] = r->values();
+            EXPECT_EQ(name, "line" + std::to_string(expected));
+            EXPECT_EQ(value, expected * 2);
+            EXPECT_TRUE(r->range().empty());
+            ++expected;
+        },
+        {4, '\n'});
+    ASSERT_TRUE(result);
+    EXPECT_EQ(expected, 100000);
+}
+
+TEST(ParallelScanTest, PreparedFormatAndDelimiter)
+{
+    auto format = scn::prepare_format<int>("{}");
+    ASSERT_TRUE(format);
+
+    std::vector<std::string_view> records;
+    std::vector<bool> successes;
+    scn::parallel_scan_lines(
+        "1;2;x;4;"sv, *format,
+        [&](std::string_view record, auto& r) {
+            records.push_back(record);
+            successes.push_back(r.has_value());
+        },
+        {2, ';'});
+    EXPECT_EQ(records,
+              (std::vector<std::string_view>{"1", "2", "x", "4"}));
+    EXPECT_EQ(successes, (std::vector<bool>{true, true, false, true}));
+}
+
+TEST(ParallelScanTest, Executor)
+{
+    scn::scan_executor executor{3};
+    EXPECT_EQ(executor.thread_count(), 3);
+
+    // Records of very different sizes
+    std::string buffer;
+    for (int i = 0; i < 20000; ++i) {
+        buffer += std::to_string(i);
+        buffer += ' ';
+        buffer.append(i % 100 == 0 ? 4000 : 1, 'x');
+        buffer += '\n';
+    }
+
+    // The executor can be reused
+    for (int round = 0; round < 3; ++round) {
+        int expected = 0;
+        auto result = scn::parallel_scan_lines<int, std::string>(
+            buffer, "{} {}",
+            [&](std::string_view, auto& r) {
+                ASSERT_TRUE(r);
+                EXPECT_EQ(std::get<0>(r->values()), expected);
+                ++expected;
+            },
+            {0, '\n', &executor});
+        ASSERT_TRUE(result);
+        EXPECT_EQ(expected, 20000);
+    }
+}
+
+#if SCN_HAS_EXCEPTIONS
+TEST(ParallelScanTest, ThrowingCallback)
+{
+    scn::scan_executor executor{2};
+    const auto buffer = make_lines(100000);
+
+    int calls = 0;
+    auto scan_until_throw = [&]() {
+        auto r = scn::parallel_scan_lines<std::string, int>(
+            buffer, "{} {}",
+            [&](std::string_view, auto&) {
+                if (++calls == 10) {
+                    throw std::runtime_error{"stop"};
+                }
+            },
+            {0, '\n', &executor});
+        SCN_UNUSED(r);
+    };
+    EXPECT_THROW(scan_until_throw(), std::runtime_error);
+    EXPECT_EQ(calls, 10);
+
+    // Still usable afterwards
+    calls = 0;
+    auto result = scn::parallel_scan_lines<std::string, int>(
+        buffer, "{} {}", [&](std::string_view, auto&) { ++calls; },
+        {0, '\n', &executor});
+    ASSERT_TRUE(result);
+    EXPECT_EQ(calls, 100000);
+}
+#endif
+
+TEST(ParallelScanTest, InvalidFormat)
+{
+    auto result = scn::parallel_scan_lines<int>(
+        "1\n2\n", scn::runtime_format("{:q}"),
+        [](std::string_view, auto&) { FAIL(); });
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_format_string);
+}
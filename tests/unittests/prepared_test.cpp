@@ -0,0 +1,125 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "wrapped_gtest.h"
+
+#include <scn/prepared.h>
+#include <scn/scan.h>
+
+using namespace std::string_view_literals;
+
+TEST(PreparedFormatTest, Simple)
+{
+    auto format = scn::prepare_format<int, double>("{} {}");
+    ASSERT_TRUE(format);
+    EXPECT_EQ(format->get(), "{} {}");
+
+    auto result = scn::scan(" 42 3.5", *format);
+    ASSERT_TRUE(result);
+    auto [i, d] = result->values();
+    EXPECT_EQ(i, 42);
+    EXPECT_DOUBLE_EQ(d, 3.5);
+    EXPECT_TRUE(result->range().empty());
+}
+
+TEST(PreparedFormatTest, ExplicitTemplateArguments)
+{
+    auto format = scn::prepare_format<int, int>("{1}:{0}");
+    ASSERT_TRUE(format);
+
+    auto result = scn::scan<int, int>("1:2", *format);
+    ASSERT_TRUE(result);
+    auto [a, b] = result->values();
+    EXPECT_EQ(a, 2);
+    EXPECT_EQ(b, 1);
+}
+
+TEST(PreparedFormatTest, Reuse)
+{
+    auto format = scn::prepare_format<std::string, int>("{:[a-z]}={:x}");
+    ASSERT_TRUE(format);
+
+    for (auto [source, key, value] :
+         {std::tuple{"foo=ff"sv, "foo"sv, 0xff},
+          std::tuple{"bar=10 rest"sv, "bar"sv, 0x10}}) {
+        auto result = scn::scan(source, *format);
+        ASSERT_TRUE(result);
+        EXPECT_EQ(std::get<0>(result->values()), key);
+        EXPECT_EQ(std::get<1>(result->values()), value);
+    }
+}
+
+TEST(PreparedFormatTest, NonAsciiCharset)
+{
+    auto format = scn::prepare_format<std::string_view>("{:[a-zä-öа-я]}");
+    ASSERT_TRUE(format);
+
+    auto result = scn::scan("käärmeжук!"sv, *format);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), "käärmeжук");
+    EXPECT_EQ(std::string_view(result->range().data(), result->range().size()),
+              "!");
+
+    auto moved = std::move(*format);
+    result = scn::scan("ÿ"sv, moved);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
+TEST(PreparedFormatTest, NonAsciiCharsetLookupIsBuiltOnce)
+{
+    auto format = scn::prepare_format<std::string_view, std::string_view>(
+        "{:[а-я]} {:[a-z]}");
+    ASSERT_TRUE(format);
+
+    const auto view = format->view();
+    const auto* lookup = view.ops[0].specs.charset_lookup;
+    ASSERT_NE(lookup, nullptr);
+    EXPECT_TRUE(lookup->contains(U'ж'));
+    EXPECT_FALSE(lookup->contains(U'ä'));
+    // ASCII-only sets don't need one
+    EXPECT_EQ(view.ops[2].specs.charset_lookup, nullptr);
+
+    auto moved = std::move(*format);
+    EXPECT_EQ(moved.view().ops[0].specs.charset_lookup, lookup);
+    auto result = scn::scan("жук abc"sv, moved);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::get<0>(result->values()), "жук");
+    EXPECT_EQ(std::get<1>(result->values()), "abc");
+}
+
+TEST(PreparedFormatTest, ScanError)
+{
+    auto format = scn::prepare_format<int>("x{}");
+    ASSERT_TRUE(format);
+
+    auto result = scn::scan("y1", *format);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_literal);
+}
+
+TEST(PreparedFormatTest, InvalidFormatString)
+{
+    for (auto str : {"{"sv, "{} {}"sv, "{1}"sv, "{0} {0}"sv, "{:q}"sv, ""sv,
+                     "{:[a-}"sv}) {
+        auto format = scn::prepare_format<int>(str);
+        ASSERT_FALSE(format) << str;
+        EXPECT_EQ(format.error().code(),
+                  scn::scan_error::invalid_format_string)
+            << str;
+    }
+}
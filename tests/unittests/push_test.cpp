@@ -0,0 +1,143 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "wrapped_gtest.h"
+
+#include <scn/push.h>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+TEST(PushScannerTest, NeedsMoreInput)
+{
+    scn::push_scanner scanner;
+    EXPECT_FALSE(scanner.scan<int>("{};"));
+
+    scanner.feed("12");
+    EXPECT_FALSE(scanner.scan<int>("{};"));
+
+    scanner.feed("3;4");
+    auto result = scanner.scan<int>("{};");
+    ASSERT_TRUE(result);
+    ASSERT_TRUE(*result);
+    EXPECT_EQ(std::get<0>(**result), 123);
+    EXPECT_EQ(scanner.position(), 4);
+
+    EXPECT_FALSE(scanner.scan<int>("{};"));
+}
+
+TEST(PushScannerTest, MessageSplitAcrossFragments)
+{
+    const std::string input = "foo 1;bar 22;baz 333;";
+    std::vector<std::pair<std::string, int>> messages;
+
+    scn::push_scanner scanner;
+    // Feed one character at a time, every fragment is destroyed after the
+    // next one has been fed
+    std::deque<std::string> fragments;
+    for (char ch : input) {
+        fragments.emplace_back(1, ch);
+        scanner.feed(fragments.back());
+        if (fragments.size() > 1) {
+            fragments.pop_front();
+        }
+
+        while (auto result = scanner.scan<std::string, int>("{} {};")) {
+            ASSERT_TRUE(*result);
+            auto& [name, value] = **result;
+            messages.emplace_back(name, value);
+        }
+    }
+
+    ASSERT_EQ(messages.size(), 3u);
+    EXPECT_EQ(messages[0].first, "foo");
+    EXPECT_EQ(messages[0].second, 1);
+    EXPECT_EQ(messages[1].first, "bar");
+    EXPECT_EQ(messages[1].second, 22);
+    EXPECT_EQ(messages[2].first, "baz");
+    EXPECT_EQ(messages[2].second, 333);
+    EXPECT_EQ(scanner.position(), static_cast<std::ptrdiff_t>(input.size()));
+}
+
+TEST(PushScannerTest, Finish)
+{
+    scn::push_scanner scanner;
+    scanner.feed("123 45");
+    auto first = scanner.scan<int>("{}");
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(*first);
+    EXPECT_EQ(std::get<0>(**first), 123);
+
+    // "45" could continue in the next fragment
+    EXPECT_FALSE(scanner.scan<int>("{}"));
+
+    scanner.finish();
+    EXPECT_TRUE(scanner.is_finished());
+    auto second = scanner.scan<int>("{}");
+    ASSERT_TRUE(second);
+    ASSERT_TRUE(*second);
+    EXPECT_EQ(std::get<0>(**second), 45);
+
+    auto third = scanner.scan<int>("{}");
+    ASSERT_TRUE(third);
+    ASSERT_FALSE(*third);
+    EXPECT_EQ(third->error().code(), scn::scan_error::end_of_input);
+}
+
+TEST(PushScannerTest, ErrorDoesntConsume)
+{
+    scn::push_scanner scanner;
+    scanner.feed("abc;12;");
+    auto result = scanner.scan<int>("{};");
+    ASSERT_TRUE(result);
+    ASSERT_FALSE(*result);
+    EXPECT_EQ(result->error().code(), scn::scan_error::invalid_scanned_value);
+    EXPECT_EQ(scanner.position(), 0);
+
+    auto skipped = scanner.scan<std::string>("{:[^;]};");
+    ASSERT_TRUE(skipped);
+    ASSERT_TRUE(*skipped);
+    EXPECT_EQ(std::get<0>(**skipped), "abc");
+
+    result = scanner.scan<int>("{};");
+    ASSERT_TRUE(result);
+    ASSERT_TRUE(*result);
+    EXPECT_EQ(std::get<0>(**result), 12);
+}
+
+TEST(PushScanBufferTest, KeepsOnlyUnconsumedInput)
+{
+    scn::detail::scan_push_buffer buf;
+    buf.feed("123 456");
+    ASSERT_TRUE(buf.sync(4));
+    EXPECT_EQ(buf.current_view(), "456");
+    EXPECT_EQ(buf.chars_available(), 3);
+
+    buf.feed("789");
+    EXPECT_EQ(buf.putback_buffer(), "456");
+    EXPECT_EQ(buf.current_view(), "789");
+
+    ASSERT_TRUE(buf.sync(4));
+    EXPECT_TRUE(buf.putback_buffer().empty());
+    EXPECT_EQ(buf.current_view(), "89");
+
+    ASSERT_TRUE(buf.sync(2));
+    buf.feed("0");
+    EXPECT_TRUE(buf.putback_buffer().empty());
+    EXPECT_EQ(buf.chars_available(), 1);
+}
@@ -277,4 +277,78 @@ TEST(RegexTest, EscapedSlashInPattern)
     EXPECT_THAT(r->value(), "foo/bar");
 }
 
+TEST(RegexTest, StaticMatches)
+{
+    auto r = scn::scan<scn::static_regex_matches<4>>(
+        "abc123 rest", "{:/([a-z]+)(_)?([0-9]+)/}");
+    ASSERT_TRUE(r);
+    EXPECT_EQ(std::string_view(r->range().data(), r->range().size()),
+              " rest");
+
+    const auto& matches = r->value();
+    ASSERT_EQ(matches.size(), 4);
+    ASSERT_TRUE(matches[0]);
+    EXPECT_EQ(matches[0]->get(), "abc123");
+    ASSERT_TRUE(matches[1]);
+    EXPECT_EQ(matches[1]->get(), "abc");
+    EXPECT_FALSE(matches[2]);
+    ASSERT_TRUE(matches[3]);
+    EXPECT_EQ(matches[3]->get(), "123");
+}
+
+TEST(RegexTest, StaticMatchesTooManySubexpressions)
+{
+    auto r = scn::scan<scn::static_regex_matches<2>>(
+        "abc123", "{:/([a-z]+)([0-9]+)/}");
+    ASSERT_FALSE(r);
+    EXPECT_EQ(r.error().code(), scn::scan_error::invalid_format_string);
+}
+
+TEST(RegexTest, StaticMatchesNoMatch)
+{
+    auto r =
+        scn::scan<scn::static_regex_matches<2>>("123", "{:/([a-z]+)/}");
+    ASSERT_FALSE(r);
+    EXPECT_EQ(r.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
+TEST(RegexTest, CacheHit)
+{
+    const auto before = scn::get_regex_cache_stats();
+    for (int i = 0; i < 3; ++i) {
+        auto r = scn::scan<std::string_view>(
+            "cached123", scn::runtime_format("{:/[a-z]+[0-9]/}"));
+        ASSERT_TRUE(r);
+        EXPECT_EQ(r->value(), "cached1");
+    }
+    const auto after = scn::get_regex_cache_stats();
+    EXPECT_EQ(after.misses - before.misses, 1);
+    EXPECT_EQ(after.hits - before.hits, 2);
+}
+
+TEST(RegexTest, CacheKeyedByFlagsAndCaptures)
+{
+    const auto before = scn::get_regex_cache_stats();
+    auto r1 = scn::scan<std::string_view>("KeyFlags", "{:/[a-z]+Flags/i}");
+    ASSERT_TRUE(r1);
+    EXPECT_EQ(r1->value(), "KeyFlags");
+    auto r2 = scn::scan<std::string_view>("KeyFlags", "{:/[a-z]+Flags/}");
+    ASSERT_FALSE(r2);
+    auto r3 = scn::scan<scn::regex_matches>("KeyFlags", "{:/[a-z]+Flags/i}");
+    ASSERT_TRUE(r3);
+    const auto after = scn::get_regex_cache_stats();
+    EXPECT_EQ(after.misses - before.misses, 3);
+    EXPECT_EQ(after.hits - before.hits, 0);
+}
+
+TEST(RegexTest, CacheInvalidRegex)
+{
+    for (int i = 0; i < 2; ++i) {
+        auto r = scn::scan<std::string>(
+            "foobar123", scn::runtime_format("{:/[uncached/}"));
+        ASSERT_FALSE(r);
+        EXPECT_EQ(r.error().code(), scn::scan_error::invalid_format_string);
+    }
+}
+
 #endif  // !SCN_DISABLE_REGEX
@@ -19,6 +19,8 @@
 
 #include <scn/scan.h>
 
+#include <optional>
+
 using ::testing::Test;
 
 template <bool, typename>
@@ -102,3 +104,130 @@ TEST(SourceTest, SourceIsStringRvalue)
         std::is_same_v<decltype(result),
                        scan_result_helper<scn::ranges::dangling, int, double>>);
 }
+
+#if SCN_POSIX || SCN_WINDOWS
+
+namespace {
+struct temporary_file {
+    temporary_file(const char* n, std::string_view contents) : name(n)
+    {
+        auto f = std::fopen(name, "wb");
+        std::fwrite(contents.data(), 1, contents.size(), f);
+        std::fclose(f);
+    }
+    ~temporary_file()
+    {
+        std::remove(name);
+    }
+
+    const char* name;
+};
+}  // namespace
+
+TEST(SourceTest, SourceIsMappedFile)
+{
+    auto tmp = temporary_file{"scn_source_test_mapped_file.txt", "foo 123"};
+    auto file = scn::mapped_file{tmp.name};
+    ASSERT_TRUE(file);
+    EXPECT_EQ(file.view(), "foo 123");
+
+    auto result = scn::scan<std::string_view, int>(file, "{} {}");
+    static_assert(std::is_same_v<
+                  decltype(result),
+                  scan_result_helper<const char*, std::string_view, int>>);
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result->range().empty());
+    auto [s, i] = result->values();
+    EXPECT_EQ(s, "foo");
+    EXPECT_EQ(s.data(), file.data());
+    EXPECT_EQ(i, 123);
+}
+
+TEST(SourceTest, SourceIsEmptyMappedFile)
+{
+    auto tmp = temporary_file{"scn_source_test_empty_mapped_file.txt", ""};
+    auto file = scn::mapped_file{tmp.name};
+    ASSERT_TRUE(file);
+    EXPECT_EQ(file.size(), 0);
+
+    auto result = scn::scan<int>(file, "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::end_of_input);
+}
+
+TEST(SourceTest, MappedFileNotFound)
+{
+    auto file = scn::mapped_file{"scn_source_test_nonexistent_file.txt"};
+    EXPECT_FALSE(file);
+}
+
+#endif
+
+TEST(SourceTest, SourceIsValidUtf8View)
+{
+    const auto input = std::string{"fööbär 123"};
+    auto result = scn::scan<std::string_view, int>(
+        scn::assume_valid_utf8(input), "{} {}");
+    static_assert(std::is_same_v<
+                  decltype(result),
+                  scan_result_helper<const char*, std::string_view, int>>);
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result->range().empty());
+    auto [s, i] = result->values();
+    EXPECT_EQ(s, "fööbär");
+    EXPECT_EQ(s.data(), input.data());
+    EXPECT_EQ(i, 123);
+
+    auto wresult =
+        scn::scan<std::wstring>(scn::assume_valid_utf8("fööbär"), "{}");
+    ASSERT_TRUE(wresult);
+    EXPECT_EQ(wresult->value(), L"fööbär");
+}
+
+namespace {
+// Scans an unrelated, invalid string while scanning
+struct nested_invalid_scan {
+    std::optional<scn::scan_error> nested_error{};
+};
+}  // namespace
+
+template <>
+struct scn::scanner<nested_invalid_scan, char> {
+    template <typename ParseCtx>
+    constexpr auto parse(ParseCtx& pctx) -> typename ParseCtx::iterator
+    {
+        return pctx.begin();
+    }
+
+    template <typename Context>
+    auto scan(nested_invalid_scan& val, Context& ctx) const
+        -> scn::scan_expected<typename Context::iterator>
+    {
+        if (auto r = scn::scan<std::string>("\xc3\x28", "{}"); !r) {
+            val.nested_error = r.error();
+        }
+        return ctx.begin();
+    }
+};
+
+TEST(SourceTest, ValidUtf8ViewDoesNotAffectNestedScans)
+{
+    auto result = scn::scan<nested_invalid_scan, std::string>(
+        scn::assume_valid_utf8("foo"), "{}{}");
+    ASSERT_TRUE(result);
+    auto [nested, str] = result->values();
+    ASSERT_TRUE(nested.nested_error);
+    EXPECT_EQ(nested.nested_error->code(),
+              scn::scan_error::invalid_scanned_value);
+    EXPECT_EQ(str, "foo");
+}
+
+TEST(SourceTest, ValidUtf8ViewDoesNotAffectOtherSources)
+{
+    auto trusted = scn::scan<std::string>(scn::assume_valid_utf8("foo"), "{}");
+    ASSERT_TRUE(trusted);
+
+    auto result = scn::scan<std::string>("\xc3\x28", "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}